@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 #include <big_number.hpp>
 
+#include <utility>
+
+#include "allocations.hpp"
 #include "constants.hpp"
 #include "tools.hpp"
 
@@ -14,3 +17,17 @@ static void Abs( benchmark::State& state ) {
     }
 }
 BENCHMARK( Abs )->Range( 1, MAX_CHUNKS );
+
+// A temporary passes its mantissa through, so no chunk is copied.
+static void AbsTemporary( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 999999999999999999 );
+    BigNumber number = create_big_number( chunks, 9, true );
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        number = abs( std::move( number ) );
+    }
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( AbsTemporary )->Range( 1, MAX_CHUNKS );
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 #include <big_number.hpp>
 
+#include "allocations.hpp"
 #include "constants.hpp"
 #include "tools.hpp"
 
@@ -15,3 +16,46 @@ static void Add( benchmark::State& state ) {
     }
 }
 BENCHMARK( Add )->Range( 1, MAX_CHUNKS );
+
+// Random chunks make the carries irregular, and the operands overlap by
+// half so all three phases of the kernel run.
+static void AddRandom( benchmark::State& state ) {
+    size_t size = state.range( 0 );
+    BigNumber a = create_big_number( create_random_chunks( size, 1 ), 9 );
+    BigNumber b = create_big_number( create_random_chunks( size, 2 ),
+                                     9 + static_cast<int32_t>( size / 2 ) );
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( add( a, b ) );
+    }
+}
+BENCHMARK( AddRandom )->Range( 1, MAX_CHUNKS );
+
+// Sums into one accumulator; add_assign() reuses its mantissa, while the
+// functional form allocates a new one per step.
+static void AddAccumulate( benchmark::State& state ) {
+    chunks addend_chunks( state.range( 0 ), 1 );
+    BigNumber accumulator = create_big_number( addend_chunks, 9 );
+    BigNumber addend = create_big_number( addend_chunks, 9 );
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        accumulator = add( accumulator, addend );
+    }
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( AddAccumulate )->Range( 1, MAX_CHUNKS );
+
+static void AddAssign( benchmark::State& state ) {
+    chunks addend_chunks( state.range( 0 ), 1 );
+    BigNumber accumulator = create_big_number( addend_chunks, 9 );
+    BigNumber addend = create_big_number( addend_chunks, 9 );
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        add_assign( accumulator, addend );
+    }
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( AddAssign )->Range( 1, MAX_CHUNKS );
@@ -0,0 +1,22 @@
+#include "allocations.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> allocation_count = 0;
+
+void* operator new( size_t size ) {
+    allocation_count.fetch_add( 1, std::memory_order_relaxed );
+
+    if ( void* pointer = std::malloc( size != 0 ? size : 1 ) ) return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete( void* pointer ) noexcept { std::free( pointer ); }
+
+void operator delete( void* pointer, size_t ) noexcept { std::free( pointer ); }
+
+size_t get_allocation_count() {
+    return allocation_count.load( std::memory_order_relaxed );
+}
@@ -0,0 +1,5 @@
+#include <cstddef>
+
+// Number of global operator new calls since the start of the benchmark
+// binary, which replaces the global allocation functions.
+size_t get_allocation_count();
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+// Values sharing their top chunks, so every comparison scans down to the
+// random low chunk.
+static std::vector<BigNumber> create_sort_input( size_t size ) {
+    chunks prefix = create_random_chunks( size, 1 );
+    std::vector<BigNumber> numbers;
+    for ( size_t i = 0; i < 1024; ++i ) {
+        prefix.front() = create_random_chunks( 1, i + 2 ).front();
+        numbers.push_back( create_big_number( prefix, 0 ) );
+    }
+    return numbers;
+}
+
+template <typename Less>
+static void sort_numbers( benchmark::State& state, Less less ) {
+    std::vector<BigNumber> numbers = create_sort_input( state.range( 0 ) );
+    std::vector<const BigNumber*> order;
+    for ( const BigNumber& number : numbers ) {
+        order.push_back( &number );
+    }
+
+    for ( auto _ : state ) {
+        std::vector<const BigNumber*> sorted = order;
+        std::ranges::sort( sorted, [&]( const auto* lhs, const auto* rhs ) {
+            return less( *lhs, *rhs );
+        } );
+        benchmark::DoNotOptimize( sorted.data() );
+    }
+}
+
+static void SortIsLowerThan( benchmark::State& state ) {
+    sort_numbers( state, []( const BigNumber& lhs, const BigNumber& rhs ) {
+        return is_lower_than( lhs, rhs );
+    } );
+}
+BENCHMARK( SortIsLowerThan )->Range( 1, 512 );
+
+static void SortCompare( benchmark::State& state ) {
+    sort_numbers( state, []( const BigNumber& lhs, const BigNumber& rhs ) {
+        return compare( lhs, rhs ) < 0;
+    } );
+}
+BENCHMARK( SortCompare )->Range( 1, 512 );
+
+// Three-way ordering of neighbours, as merging or deduplication needs it.
+static void OrderTwoCalls( benchmark::State& state ) {
+    std::vector<BigNumber> numbers = create_sort_input( state.range( 0 ) );
+    for ( auto _ : state ) {
+        int sum = 0;
+        for ( size_t i = 1; i < numbers.size(); ++i ) {
+            const BigNumber& lhs = numbers[i - 1];
+            const BigNumber& rhs = numbers[i];
+            sum += is_equal( lhs, rhs ) ? 0 : is_lower_than( lhs, rhs ) ? -1
+                                                                        : 1;
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+}
+BENCHMARK( OrderTwoCalls )->Range( 1, 512 );
+
+static void OrderCompare( benchmark::State& state ) {
+    std::vector<BigNumber> numbers = create_sort_input( state.range( 0 ) );
+    for ( auto _ : state ) {
+        int sum = 0;
+        for ( size_t i = 1; i < numbers.size(); ++i ) {
+            sum += compare( numbers[i - 1], numbers[i] );
+        }
+        benchmark::DoNotOptimize( sum );
+    }
+}
+BENCHMARK( OrderCompare )->Range( 1, 512 );
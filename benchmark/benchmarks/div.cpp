@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+static void Div( benchmark::State& state ) {
+    chunks lhs( MAX_CHUNKS, 999999999999999999 );
+    chunks rhs( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( lhs, 9 );
+    BigNumber b = create_big_number( rhs, 9 );
+    for ( auto _ : state ) {
+        div( a, b );
+    }
+}
+BENCHMARK( Div )->Range( 1, MAX_CHUNKS )->Arg( MAX_CHUNKS / 2 );
+
+static void Inv( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( chunks, 0 );
+    for ( auto _ : state ) {
+        inv( a );
+    }
+}
+BENCHMARK( Inv )->Range( 1, MAX_CHUNKS );
+
+// A dividend of twice the divisor size, across the switch from schoolbook
+// division to the Newton reciprocal.
+static void DivRemainder( benchmark::State& state ) {
+    chunks lhs( 2 * state.range( 0 ), 999999999999999999 );
+    chunks rhs( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( lhs, 9 );
+    BigNumber b = create_big_number( rhs, 9 );
+    for ( auto _ : state ) {
+        div_rem( a, b );
+    }
+}
+BENCHMARK( DivRemainder )
+    ->DenseRange( 50, 400, 50 )
+    ->Arg( 1000 )
+    ->Arg( MAX_CHUNKS / 2 );
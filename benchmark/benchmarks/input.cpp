@@ -12,3 +12,12 @@ static void DefaultInput( benchmark::State& state ) {
     }
 }
 BENCHMARK( DefaultInput )->Range( 1, 100000 );
+
+static void ParseInput( benchmark::State& state ) {
+    std::string text( state.range( 0 ), '9' );
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( parse( text ) );
+    }
+}
+BENCHMARK( ParseInput )->Range( 1, 100000 );
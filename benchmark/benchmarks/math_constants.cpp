@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+
+#include "constants.hpp"
+
+using namespace big_number;
+
+// Every iteration starts from an empty cache, so the series are summed
+// again; the argument is the precision in digits.
+static void Constant( benchmark::State& state,
+                      BigNumber ( *constant )( size_t ) ) {
+    for ( auto _ : state ) {
+        state.PauseTiming();
+        clear_constants_cache();
+        state.ResumeTiming();
+
+        constant( state.range( 0 ) );
+    }
+}
+BENCHMARK_CAPTURE( Constant, Pi, pi )
+    ->Range( 1000, PRECISION )
+    ->Unit( benchmark::kMillisecond );
+BENCHMARK_CAPTURE( Constant, E, e )
+    ->Range( 1000, PRECISION )
+    ->Unit( benchmark::kMillisecond );
+BENCHMARK_CAPTURE( Constant, Ln2, ln2 )
+    ->Range( 1000, PRECISION )
+    ->Unit( benchmark::kMillisecond );
+
+static void PiThreads( benchmark::State& state ) {
+    set_mul_threads( state.range( 0 ) );
+
+    for ( auto _ : state ) {
+        state.PauseTiming();
+        clear_constants_cache();
+        state.ResumeTiming();
+
+        pi();
+    }
+
+    set_mul_threads( 1 );
+}
+BENCHMARK( PiThreads )
+    ->RangeMultiplier( 2 )
+    ->Range( 1, 8 )
+    ->UseRealTime()
+    ->Unit( benchmark::kMillisecond );
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "allocations.hpp"
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+enum class MantissaMemory { HEAP, ARENA, POOL };
+
+// A request-scoped computation: a few hundred temporaries of 16 to 32
+// chunks that all die at the end of the iteration.
+static BigNumber run_request( const std::vector<BigNumber>& operands ) {
+    BigNumber sum = make_zero( get_default_error() );
+    for ( size_t i = 1; i < operands.size(); ++i ) {
+        sum = add( sum, mul( operands[i - 1], operands[i] ) );
+    }
+    return sum;
+}
+
+static void Request( benchmark::State& state, MantissaMemory memory ) {
+    std::vector<BigNumber> operands;
+    for ( uint64_t seed = 1; seed <= 256; ++seed ) {
+        operands.push_back(
+            create_big_number( create_random_chunks( 16, seed ), -8 ) );
+    }
+
+    std::unique_ptr<std::pmr::memory_resource> pool = make_mantissa_pool();
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        std::unique_ptr<std::pmr::memory_resource> arena;
+        std::pmr::memory_resource* resource = nullptr;
+        if ( memory == MantissaMemory::ARENA ) {
+            arena = make_mantissa_arena( 256 * 64 );
+            resource = arena.get();
+        } else if ( memory == MantissaMemory::POOL ) {
+            resource = pool.get();
+        }
+
+        MantissaResourceScope scope( resource );
+        benchmark::DoNotOptimize( run_request( operands ) );
+    }
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+BENCHMARK_CAPTURE( Request, Heap, MantissaMemory::HEAP )->ThreadRange( 1, 8 );
+BENCHMARK_CAPTURE( Request, Arena, MantissaMemory::ARENA )->ThreadRange( 1, 8 );
+BENCHMARK_CAPTURE( Request, Pool, MantissaMemory::POOL )->ThreadRange( 1, 8 );
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 #include <big_number.hpp>
 
+#include "allocations.hpp"
 #include "constants.hpp"
 #include "tools.hpp"
 
@@ -15,3 +16,151 @@ static void Mul( benchmark::State& state ) {
     }
 }
 BENCHMARK( Mul )->Range( 1, MAX_CHUNKS );
+
+static void MulTier( benchmark::State& state, MulAlgorithm algorithm ) {
+    chunks lhs( state.range( 0 ), 999999999999999999 );
+    chunks rhs( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( lhs, 9 );
+    BigNumber b = create_big_number( rhs, 9 );
+    for ( auto _ : state ) {
+        mul( a, b, algorithm );
+    }
+}
+BENCHMARK_CAPTURE( MulTier, Schoolbook, MulAlgorithm::SCHOOLBOOK )
+    ->DenseRange( 32, 256, 32 )
+    ->Arg( 500 )
+    ->Arg( 1000 );
+BENCHMARK_CAPTURE( MulTier, Karatsuba, MulAlgorithm::KARATSUBA )
+    ->DenseRange( 32, 256, 32 )
+    ->DenseRange( 500, 2000, 500 )
+    ->Arg( 4000 )
+    ->Arg( MAX_CHUNKS );
+BENCHMARK_CAPTURE( MulTier, Toom3, MulAlgorithm::TOOM3 )
+    ->DenseRange( 128, 384, 64 )
+    ->DenseRange( 500, 2000, 500 )
+    ->Arg( 4000 )
+    ->Arg( MAX_CHUNKS );
+BENCHMARK_CAPTURE( MulTier, Ntt, MulAlgorithm::NTT )
+    ->DenseRange( 128, 384, 64 )
+    ->DenseRange( 500, 2000, 500 )
+    ->Arg( 4000 )
+    ->Arg( MAX_CHUNKS );
+
+// Operand lengths on both sides of the power-of-two transform lengths.
+static void MulNttLength( benchmark::State& state ) {
+    chunks lhs( state.range( 0 ), 999999999999999999 );
+    chunks rhs( state.range( 1 ), 899999999999999999 );
+    BigNumber a = create_big_number( lhs, 9 );
+    BigNumber b = create_big_number( rhs, 9 );
+    for ( auto _ : state ) {
+        mul( a, b, MulAlgorithm::NTT );
+    }
+}
+BENCHMARK( MulNttLength )
+    ->Args( { 1000, 1000 } )
+    ->Args( { 1100, 1100 } )
+    ->Args( { 2000, 2000 } )
+    ->Args( { 2100, 2100 } )
+    ->Args( { 2800, 2800 } )
+    ->Args( { 4100, 1500 } )
+    ->Args( { MAX_CHUNKS, 700 } )
+    ->Args( { MAX_CHUNKS, MAX_CHUNKS } );
+
+static void SqrTier( benchmark::State& state, MulAlgorithm algorithm ) {
+    chunks chunks( state.range( 0 ), 999999999999999999 );
+    BigNumber a = create_big_number( chunks, 9 );
+    for ( auto _ : state ) {
+        sqr( a, algorithm );
+    }
+}
+BENCHMARK_CAPTURE( SqrTier, Schoolbook, MulAlgorithm::SCHOOLBOOK )
+    ->DenseRange( 32, 256, 32 )
+    ->Arg( 500 )
+    ->Arg( 1000 );
+BENCHMARK_CAPTURE( SqrTier, Karatsuba, MulAlgorithm::KARATSUBA )
+    ->DenseRange( 32, 256, 32 )
+    ->DenseRange( 500, 2000, 500 )
+    ->Arg( 4000 )
+    ->Arg( MAX_CHUNKS );
+BENCHMARK_CAPTURE( SqrTier, Toom3, MulAlgorithm::TOOM3 )
+    ->DenseRange( 128, 384, 64 )
+    ->DenseRange( 500, 2000, 500 )
+    ->Arg( 4000 )
+    ->Arg( MAX_CHUNKS );
+BENCHMARK_CAPTURE( SqrTier, Ntt, MulAlgorithm::NTT )
+    ->DenseRange( 128, 384, 64 )
+    ->DenseRange( 500, 2000, 500 )
+    ->Arg( 4000 )
+    ->Arg( MAX_CHUNKS );
+
+static void MulPrepared( benchmark::State& state ) {
+    chunks lhs( state.range( 0 ), 999999999999999999 );
+    chunks rhs( state.range( 0 ), 899999999999999999 );
+    PreparedOperand a = prepare_mul( create_big_number( lhs, 9 ) );
+    BigNumber b = create_big_number( rhs, 9 );
+    for ( auto _ : state ) {
+        mul( a, b );
+    }
+}
+BENCHMARK( MulPrepared )->DenseRange( 2500, 4000, 1500 )->Arg( MAX_CHUNKS );
+
+// Heap allocations per product once the twiddle tables and the NTT
+// workspace are warm; the result mantissa accounts for one.
+static void MulAllocations( benchmark::State& state ) {
+    chunks lhs( state.range( 0 ), 999999999999999999 );
+    chunks rhs( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( lhs, 9 );
+    BigNumber b = create_big_number( rhs, 9 );
+    mul( a, b );
+
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( mul( a, b ) );
+    }
+
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( MulAllocations )->Arg( 2500 )->Arg( 4000 );
+
+static void MulNttBackend( benchmark::State& state, NttBackend backend ) {
+    if ( !set_ntt_backend( backend ) ) {
+        state.SkipWithError( "NTT backend is not supported on this host" );
+        return;
+    }
+
+    chunks lhs( state.range( 0 ), 999999999999999999 );
+    chunks rhs( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( lhs, 9 );
+    BigNumber b = create_big_number( rhs, 9 );
+    for ( auto _ : state ) {
+        mul( a, b, MulAlgorithm::NTT );
+    }
+
+    set_ntt_backend( NttBackend::AUTO );
+}
+BENCHMARK_CAPTURE( MulNttBackend, Scalar, NttBackend::SCALAR )
+    ->DenseRange( 1000, 4000, 1500 )
+    ->Arg( MAX_CHUNKS );
+BENCHMARK_CAPTURE( MulNttBackend, Avx2, NttBackend::AVX2 )
+    ->DenseRange( 1000, 4000, 1500 )
+    ->Arg( MAX_CHUNKS );
+BENCHMARK_CAPTURE( MulNttBackend, Avx512, NttBackend::AVX512 )
+    ->DenseRange( 1000, 4000, 1500 )
+    ->Arg( MAX_CHUNKS );
+
+static void MulThreads( benchmark::State& state ) {
+    set_mul_threads( state.range( 0 ) );
+
+    chunks lhs( MAX_CHUNKS, 999999999999999999 );
+    chunks rhs( MAX_CHUNKS, 899999999999999999 );
+    BigNumber a = create_big_number( lhs, 9 );
+    BigNumber b = create_big_number( rhs, 9 );
+    for ( auto _ : state ) {
+        mul( a, b, MulAlgorithm::NTT );
+    }
+
+    set_mul_threads( 1 );
+}
+BENCHMARK( MulThreads )->RangeMultiplier( 2 )->Range( 1, 32 )->UseRealTime();
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 #include <big_number.hpp>
 
+#include "allocations.hpp"
 #include "constants.hpp"
 #include "tools.hpp"
 
@@ -14,3 +15,38 @@ static void Output( benchmark::State& state ) {
     }
 }
 BENCHMARK( Output )->Range( 1, MAX_CHUNKS );
+
+// Heap allocations per call; the result string accounts for one.
+static void OutputAllocations( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 999999999999999999 );
+    BigNumber number = create_big_number( chunks, -9 );
+
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( to_string( number ) );
+    }
+
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( OutputAllocations )->Arg( MAX_CHUNKS );
+
+// Formats into a caller buffer reused across calls, so no heap allocation
+// is expected.
+static void OutputToChars( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 999999999999999999 );
+    BigNumber number = create_big_number( chunks, -9 );
+    std::string buffer( formatted_length( number ), '\0' );
+
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( to_chars(
+            buffer.data(), buffer.data() + buffer.size(), number ) );
+    }
+
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( OutputToChars )->Range( 1, MAX_CHUNKS );
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+static void Serialize( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 999999999999999999 );
+    BigNumber number = create_big_number( chunks, 9 );
+    std::vector<std::byte> buffer( serialized_size( number ) );
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( serialize( number, buffer ) );
+    }
+}
+BENCHMARK( Serialize )->Range( 1, MAX_CHUNKS );
+
+static void Deserialize( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 999999999999999999 );
+    BigNumber number = create_big_number( chunks, 9 );
+    std::vector<std::byte> buffer( serialized_size( number ) );
+    serialize( number, buffer );
+    BigNumberView view;
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( deserialize( buffer, view ) );
+    }
+}
+BENCHMARK( Deserialize )->Range( 1, MAX_CHUNKS );
+
+// The text round trip that the binary format replaces.
+static void TextRoundTrip( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 999999999999999999 );
+    BigNumber number = create_big_number( chunks, 9 );
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( parse( to_string( number ) ) );
+    }
+}
+BENCHMARK( TextRoundTrip )->Range( 1, MAX_CHUNKS );
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+
+#include "allocations.hpp"
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+// Operands of 1 to 4 chunks, the size most values have in practice, with
+// the heap allocations each operation makes.
+template <typename Operation>
+static void SmallOperands( benchmark::State& state, Operation operation ) {
+    size_t size = state.range( 0 );
+    BigNumber lhs = create_big_number( create_random_chunks( size, 1 ), -1 );
+    BigNumber rhs = create_big_number( create_random_chunks( size, 2 ), -2 );
+    size_t allocations = get_allocation_count();
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( operation( lhs, rhs ) );
+    }
+    state.counters["allocations"] = benchmark::Counter(
+        get_allocation_count() - allocations,
+        benchmark::Counter::kAvgIterations );
+}
+
+BENCHMARK_CAPTURE( SmallOperands,
+                   Copy,
+                   []( const BigNumber& lhs, const BigNumber& ) {
+                       return BigNumber( lhs );
+                   } )
+    ->DenseRange( 1, 4 );
+BENCHMARK_CAPTURE( SmallOperands,
+                   Neg,
+                   []( const BigNumber& lhs, const BigNumber& ) {
+                       return neg( lhs );
+                   } )
+    ->DenseRange( 1, 4 );
+BENCHMARK_CAPTURE( SmallOperands,
+                   Abs,
+                   []( const BigNumber&, const BigNumber& rhs ) {
+                       return abs( rhs );
+                   } )
+    ->DenseRange( 1, 4 );
+BENCHMARK_CAPTURE( SmallOperands,
+                   Add,
+                   []( const BigNumber& lhs, const BigNumber& rhs ) {
+                       return add( lhs, rhs );
+                   } )
+    ->DenseRange( 1, 4 );
+BENCHMARK_CAPTURE( SmallOperands,
+                   Sub,
+                   []( const BigNumber& lhs, const BigNumber& rhs ) {
+                       return sub( lhs, rhs );
+                   } )
+    ->DenseRange( 1, 4 );
+BENCHMARK_CAPTURE( SmallOperands,
+                   Mul,
+                   []( const BigNumber& lhs, const BigNumber& rhs ) {
+                       return mul( lhs, rhs );
+                   } )
+    ->DenseRange( 1, 4 );
+BENCHMARK_CAPTURE( SmallOperands,
+                   Div,
+                   []( const BigNumber& lhs, const BigNumber& rhs ) {
+                       return div( lhs, rhs );
+                   } )
+    ->DenseRange( 1, 4 );
@@ -0,0 +1,25 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+static void Sqrt( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( chunks, 0 );
+    for ( auto _ : state ) {
+        sqrt( a );
+    }
+}
+BENCHMARK( Sqrt )->Range( 1, MAX_CHUNKS );
+
+static void Rsqrt( benchmark::State& state ) {
+    chunks chunks( state.range( 0 ), 899999999999999999 );
+    BigNumber a = create_big_number( chunks, -state.range( 0 ) );
+    for ( auto _ : state ) {
+        rsqrt( a );
+    }
+}
+BENCHMARK( Rsqrt )->Range( 1, MAX_CHUNKS );
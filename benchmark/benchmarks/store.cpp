@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <big_number.hpp>
+#include <unistd.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+constexpr size_t STORE_VALUES = 100000;
+constexpr size_t STORE_VALUE_CHUNKS = 4;
+
+static std::vector<BigNumber> create_table() {
+    std::vector<BigNumber> numbers;
+    numbers.reserve( STORE_VALUES );
+    for ( size_t i = 0; i < STORE_VALUES; ++i ) {
+        chunks chunks( STORE_VALUE_CHUNKS, 999999999999999999 - i );
+        numbers.push_back( create_big_number( chunks, -2 ) );
+    }
+    return numbers;
+}
+
+static std::string create_store_path() {
+    return ( std::filesystem::temp_directory_path() /
+             ( "big_number_bench_" + std::to_string( ::getpid() ) + ".bin" ) )
+        .string();
+}
+
+// Startup cost of a table: mapping the store against parsing its text.
+static void StoreOpen( benchmark::State& state ) {
+    std::string path = create_store_path();
+    write_store( path, create_table() );
+
+    for ( auto _ : state ) {
+        BigNumberStore store = open_store( path );
+        benchmark::DoNotOptimize( get_store_value( store, 0 ) );
+    }
+
+    std::filesystem::remove( path );
+}
+BENCHMARK( StoreOpen )->Unit( benchmark::kMillisecond );
+
+static void StoreTextParse( benchmark::State& state ) {
+    std::vector<std::string> texts;
+    for ( const BigNumber& number : create_table() ) {
+        texts.push_back( to_string( number ) );
+    }
+
+    for ( auto _ : state ) {
+        std::vector<BigNumber> numbers;
+        numbers.reserve( texts.size() );
+        for ( const std::string& text : texts ) {
+            numbers.push_back( parse( text ) );
+        }
+        benchmark::DoNotOptimize( numbers.data() );
+    }
+}
+BENCHMARK( StoreTextParse )->Unit( benchmark::kMillisecond );
+
+static void StoreRandomAccess( benchmark::State& state ) {
+    std::string path = create_store_path();
+    write_store( path, create_table() );
+    BigNumberStore store = open_store( path );
+    size_t index = 0;
+
+    for ( auto _ : state ) {
+        index = ( index + 7919 ) % STORE_VALUES;
+        benchmark::DoNotOptimize( get_store_value( store, index ) );
+    }
+
+    std::filesystem::remove( path );
+}
+BENCHMARK( StoreRandomAccess );
@@ -15,3 +15,16 @@ static void Sub( benchmark::State& state ) {
     }
 }
 BENCHMARK( Sub )->Range( 1, MAX_CHUNKS );
+
+// Random chunks make the carries irregular, and the operands overlap by
+// half so all three phases of the kernel run.
+static void SubRandom( benchmark::State& state ) {
+    size_t size = state.range( 0 );
+    BigNumber a = create_big_number( create_random_chunks( size, 1 ), 9 );
+    BigNumber b = create_big_number( create_random_chunks( size, 2 ),
+                                     9 + static_cast<int32_t>( size / 2 ) );
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize( sub( b, a ) );
+    }
+}
+BENCHMARK( SubRandom )->Range( 1, MAX_CHUNKS );
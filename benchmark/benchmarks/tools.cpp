@@ -1,5 +1,9 @@
 #include "tools.hpp"
 
+#include <random>
+
+#include "constants.hpp"
+
 BigNumber create_big_number( const chunks& chunks,
                              int32_t shift,
                              bool is_negative,
@@ -12,3 +16,14 @@ BigNumber create_big_number( const chunks& chunks,
     number.error = big_number::Error{};
     return number;
 }
+
+chunks create_random_chunks( size_t size, uint64_t seed ) {
+    std::mt19937_64 generator( seed );
+    std::uniform_int_distribution<chunk> distribution( 1, MAX_CHUNK - 1 );
+
+    chunks mantissa( size );
+    for ( chunk& value : mantissa ) {
+        value = distribution( generator );
+    }
+    return mantissa;
+}
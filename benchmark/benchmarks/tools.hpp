@@ -7,3 +7,5 @@ BigNumber create_big_number(
     int32_t shift,
     bool is_negative = false,
     big_number::BigNumberType type = big_number::BigNumberType::DEFAULT );
+
+chunks create_random_chunks( size_t size, uint64_t seed );
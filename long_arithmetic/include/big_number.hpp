@@ -1,6 +1,12 @@
 #pragma once
 
+#include <charconv>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include "constants.hpp"
 #include "error.hpp"
@@ -13,6 +19,21 @@ namespace big_number {
         NOT_A_NUMBER,
     };
 
+    enum class MulAlgorithm : uint8_t {
+        AUTO,
+        SCHOOLBOOK,
+        KARATSUBA,
+        TOOM3,
+        NTT,
+    };
+
+    enum class NttBackend : uint8_t {
+        AUTO,
+        SCALAR,
+        AVX2,
+        AVX512,
+    };
+
     struct BigNumber {
         chunks mantissa;
         int32_t shift;
@@ -21,32 +42,193 @@ namespace big_number {
         bool is_negative;
     };
 
+    struct BigNumberView {
+        std::span<const chunk> mantissa;
+        int32_t shift;
+        BigNumberType type;
+        Error error;
+        bool is_negative;
+    };
+
+    struct StoreMapping;
+
+    struct BigNumberStore {
+        std::shared_ptr<const StoreMapping> mapping;
+        std::span<const uint64_t> offsets;
+        Error error;
+    };
+
+    struct PreparedTransforms;
+
+    struct PreparedOperand {
+        BigNumber number;
+        std::shared_ptr<PreparedTransforms> transforms;
+    };
+
+    struct MantissaResourceScope {
+        explicit MantissaResourceScope( std::pmr::memory_resource* resource );
+        ~MantissaResourceScope();
+
+        MantissaResourceScope( const MantissaResourceScope& ) = delete;
+        MantissaResourceScope&
+        operator=( const MantissaResourceScope& ) = delete;
+
+        std::pmr::memory_resource* previous;
+    };
+
+    struct DivRem {
+        BigNumber quotient;
+        BigNumber remainder;
+    };
+
     BigNumber make_big_number( digits digits,
                                int32_t exponent,
                                bool is_negative,
                                const Error& error );
 
+    std::from_chars_result
+    from_chars( const char* first, const char* last, BigNumber& number );
+
+    BigNumber parse( std::string_view text );
+
     BigNumber make_zero( const Error& error, bool is_negative = false );
 
     BigNumber make_nan( const Error& error, bool is_negative = false );
 
     BigNumber make_inf( const Error& error, bool is_negative );
 
+    BigNumberView make_view( const BigNumber& number );
+
+    BigNumber make_big_number( const BigNumberView& view );
+
     const Error& get_error( const BigNumber& number );
 
     BigNumber abs( const BigNumber& number );
 
+    BigNumber abs( BigNumber&& number );
+
+    BigNumberView abs( const BigNumberView& number );
+
     BigNumber neg( const BigNumber& number );
 
+    BigNumber neg( BigNumber&& number );
+
+    BigNumberView neg( const BigNumberView& number );
+
     BigNumber add( const BigNumber& augend, const BigNumber& addend );
 
     BigNumber sub( const BigNumber& minuend, const BigNumber& subtrahend );
 
+    BigNumber add( const BigNumberView& augend, const BigNumberView& addend );
+
+    BigNumber sub( const BigNumberView& minuend,
+                   const BigNumberView& subtrahend );
+
+    void add_assign( BigNumber& accumulator, const BigNumber& addend );
+
+    void sub_assign( BigNumber& accumulator, const BigNumber& subtrahend );
+
+    void add_assign( BigNumber& accumulator, const BigNumberView& addend );
+
+    void sub_assign( BigNumber& accumulator, const BigNumberView& subtrahend );
+
     BigNumber mul( const BigNumber& multiplicand, const BigNumber& multiplier );
 
+    BigNumber mul( const BigNumber& multiplicand,
+                   const BigNumber& multiplier,
+                   MulAlgorithm algorithm );
+
+    BigNumber mul( const BigNumberView& multiplicand,
+                   const BigNumberView& multiplier );
+
+    BigNumber sqr( const BigNumber& number );
+
+    BigNumber sqr( const BigNumber& number, MulAlgorithm algorithm );
+
+    PreparedOperand prepare_mul( const BigNumber& number );
+
+    BigNumber mul( const PreparedOperand& multiplicand,
+                   const BigNumber& multiplier );
+
+    BigNumber div( const BigNumber& dividend, const BigNumber& divisor );
+
+    BigNumber inv( const BigNumber& number );
+
+    DivRem div_rem( const BigNumber& dividend, const BigNumber& divisor );
+
+    BigNumber sqrt( const BigNumber& number );
+
+    BigNumber rsqrt( const BigNumber& number );
+
+    BigNumber pi( size_t precision = PRECISION );
+
+    BigNumber e( size_t precision = PRECISION );
+
+    BigNumber ln2( size_t precision = PRECISION );
+
+    void clear_constants_cache();
+
+    bool is_ntt_backend_supported( NttBackend backend );
+
+    bool set_ntt_backend( NttBackend backend );
+
+    NttBackend get_ntt_backend();
+
+    void set_mul_threads( size_t threads );
+
+    size_t get_mul_threads();
+
+    std::pmr::memory_resource* get_mantissa_resource();
+
+    std::pmr::memory_resource*
+    set_mantissa_resource( std::pmr::memory_resource* resource );
+
+    std::unique_ptr<std::pmr::memory_resource>
+    make_mantissa_arena( size_t initial_chunks );
+
+    std::unique_ptr<std::pmr::memory_resource> make_mantissa_pool();
+
     bool is_equal( const BigNumber& left, const BigNumber& right );
 
     bool is_lower_than( const BigNumber& left, const BigNumber& right );
 
+    bool is_equal( const BigNumberView& left, const BigNumberView& right );
+
+    bool is_lower_than( const BigNumberView& left, const BigNumberView& right );
+
+    int compare( const BigNumber& left, const BigNumber& right );
+
+    int compare_abs( const BigNumber& left, const BigNumber& right );
+
+    int compare( const BigNumberView& left, const BigNumberView& right );
+
+    int compare_abs( const BigNumberView& left, const BigNumberView& right );
+
     std::string to_string( const BigNumber& number );
+
+    size_t formatted_length( const BigNumber& number );
+
+    size_t serialized_size( const BigNumber& number );
+
+    size_t serialized_size( const BigNumberView& number );
+
+    size_t serialize( const BigNumber& number, std::span<std::byte> buffer );
+
+    size_t serialize( const BigNumberView& number,
+                      std::span<std::byte> buffer );
+
+    size_t deserialize( std::span<const std::byte> buffer,
+                        BigNumberView& number );
+
+    Error write_store( const std::string& path,
+                       std::span<const BigNumber> numbers );
+
+    BigNumberStore open_store( const std::string& path );
+
+    size_t get_store_size( const BigNumberStore& store );
+
+    BigNumberView get_store_value( const BigNumberStore& store, size_t index );
+
+    std::to_chars_result
+    to_chars( char* first, char* last, const BigNumber& number );
 }
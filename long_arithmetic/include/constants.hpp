@@ -4,12 +4,18 @@
 #include <limits>
 #include <vector>
 
+#include "small_vector.hpp"
+
 namespace big_number {
     using digit = uint8_t;
     using digits = std::vector<digit>;
     using mul_chunk = __uint128_t;
     using chunk = uint64_t;
-    using chunks = std::vector<chunk>;
+
+    // Values of up to this many chunks (72 digits) keep their mantissa
+    // inline.
+    constexpr size_t INLINE_CHUNKS = 4;
+    using chunks = SmallVector<chunk, INLINE_CHUNKS>;
 
     constexpr int32_t BASE = 18;
     constexpr size_t PRECISION = 100000;
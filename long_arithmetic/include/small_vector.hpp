@@ -0,0 +1,368 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace big_number {
+    // A std::vector work-alike keeping up to N elements inline, so short
+    // values never touch the heap. Elements are trivially copyable and are
+    // moved around with memcpy. Moving a vector whose elements are inline
+    // copies them, so pointers into it do not survive the move.
+    //
+    // Longer contents come from the memory resource that was current on the
+    // constructing thread, or from operator new when there was none. Like a
+    // std::pmr container, a move keeps the resource with the buffer. Move
+    // assignment between different resources copies instead.
+    template <typename T, size_t N>
+    class SmallVector {
+        static_assert( std::is_trivially_copyable_v<T>,
+                       "SmallVector relocates elements with memcpy" );
+        static_assert( N > 0, "SmallVector needs inline capacity" );
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        SmallVector() noexcept = default;
+
+        explicit SmallVector( size_type count ) { resize( count ); }
+
+        SmallVector( size_type count, const T& value ) {
+            assign( count, value );
+        }
+
+        template <std::input_iterator Iterator>
+        SmallVector( Iterator first, Iterator last ) {
+            assign( first, last );
+        }
+
+        SmallVector( std::initializer_list<T> values ) {
+            assign( values.begin(), values.end() );
+        }
+
+        SmallVector( const SmallVector& other ) {
+            assign( other.begin(), other.end() );
+        }
+
+        SmallVector( SmallVector&& other ) noexcept
+            : resource_( other.resource_ ) {
+            take( other );
+        }
+
+        ~SmallVector() { release(); }
+
+        SmallVector& operator=( const SmallVector& other ) {
+            if ( this != &other ) assign( other.begin(), other.end() );
+            return *this;
+        }
+
+        SmallVector& operator=( SmallVector&& other ) {
+            if ( this == &other ) return *this;
+
+            if ( other.is_inline() || resource_ == other.resource_ ) {
+                release();
+                take( other );
+            } else {
+                assign( other.begin(), other.end() );
+            }
+            return *this;
+        }
+
+        // The resource vectors constructed on this thread allocate from;
+        // nullptr stands for operator new.
+        static std::pmr::memory_resource* get_thread_resource() noexcept {
+            return thread_resource;
+        }
+
+        // Returns the previous resource of this thread.
+        static std::pmr::memory_resource*
+        set_thread_resource( std::pmr::memory_resource* resource ) noexcept {
+            return std::exchange( thread_resource, resource );
+        }
+
+        std::pmr::memory_resource* get_resource() const noexcept {
+            return resource_;
+        }
+
+        SmallVector& operator=( std::initializer_list<T> values ) {
+            assign( values.begin(), values.end() );
+            return *this;
+        }
+
+        void assign( size_type count, const T& value ) {
+            T copy = value;
+            clear();
+            reserve( count );
+            std::fill_n( data_, count, copy );
+            size_ = count;
+        }
+
+        template <std::input_iterator Iterator>
+        void assign( Iterator first, Iterator last ) {
+            if constexpr ( std::forward_iterator<Iterator> ) {
+                size_type count = std::distance( first, last );
+                if ( count > capacity_ ) {
+                    SmallVector other;
+                    other.resource_ = resource_;
+                    other.reserve( count );
+                    std::copy( first, last, other.data_ );
+                    other.size_ = count;
+                    *this = std::move( other );
+                    return;
+                }
+                std::copy( first, last, data_ );
+                size_ = count;
+            } else {
+                clear();
+                for ( ; first != last; ++first ) {
+                    push_back( *first );
+                }
+            }
+        }
+
+        iterator begin() noexcept { return data_; }
+        const_iterator begin() const noexcept { return data_; }
+        const_iterator cbegin() const noexcept { return data_; }
+        iterator end() noexcept { return data_ + size_; }
+        const_iterator end() const noexcept { return data_ + size_; }
+        const_iterator cend() const noexcept { return data_ + size_; }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator( end() ); }
+        const_reverse_iterator rbegin() const noexcept {
+            return const_reverse_iterator( end() );
+        }
+        reverse_iterator rend() noexcept { return reverse_iterator( begin() ); }
+        const_reverse_iterator rend() const noexcept {
+            return const_reverse_iterator( begin() );
+        }
+
+        T* data() noexcept { return data_; }
+        const T* data() const noexcept { return data_; }
+        size_type size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        size_type capacity() const noexcept { return capacity_; }
+
+        size_type max_size() const noexcept {
+            return std::allocator_traits<std::allocator<T>>::max_size(
+                std::allocator<T>() );
+        }
+
+        T& operator[]( size_type index ) { return data_[index]; }
+        const T& operator[]( size_type index ) const { return data_[index]; }
+
+        T& at( size_type index ) {
+            if ( index >= size_ ) throw std::out_of_range( "SmallVector::at" );
+            return data_[index];
+        }
+
+        const T& at( size_type index ) const {
+            if ( index >= size_ ) throw std::out_of_range( "SmallVector::at" );
+            return data_[index];
+        }
+
+        T& front() { return data_[0]; }
+        const T& front() const { return data_[0]; }
+        T& back() { return data_[size_ - 1]; }
+        const T& back() const { return data_[size_ - 1]; }
+
+        void reserve( size_type count ) {
+            if ( count <= capacity_ ) return;
+
+            T* buffer = allocate( count );
+            if ( size_ != 0 ) std::memcpy( buffer, data_, size_ * sizeof( T ) );
+            release();
+            data_ = buffer;
+            capacity_ = count;
+        }
+
+        void shrink_to_fit() {
+            if ( is_inline() || size_ == capacity_ ) return;
+
+            SmallVector other;
+            other.resource_ = resource_;
+            other.assign( begin(), end() );
+            *this = std::move( other );
+        }
+
+        void clear() noexcept { size_ = 0; }
+
+        void resize( size_type count ) { resize( count, T() ); }
+
+        void resize( size_type count, const T& value ) {
+            if ( count > size_ ) {
+                T copy = value;
+                grow( count );
+                std::fill( data_ + size_, data_ + count, copy );
+            }
+            size_ = count;
+        }
+
+        void push_back( T value ) {
+            grow( size_ + 1 );
+            data_[size_++] = value;
+        }
+
+        template <typename... Args>
+        T& emplace_back( Args&&... args ) {
+            push_back( T( std::forward<Args>( args )... ) );
+            return back();
+        }
+
+        void pop_back() { --size_; }
+
+        iterator insert( const_iterator position, T value ) {
+            return insert( position, 1, value );
+        }
+
+        iterator insert( const_iterator position, size_type count, T value ) {
+            size_type index = position - data_;
+            open_gap( index, count );
+            std::fill_n( data_ + index, count, value );
+            return data_ + index;
+        }
+
+        template <std::input_iterator Iterator>
+        iterator insert( const_iterator position,
+                         Iterator first,
+                         Iterator last ) {
+            size_type index = position - data_;
+            if constexpr ( std::forward_iterator<Iterator> &&
+                           std::is_pointer_v<Iterator> ) {
+                if ( is_own( first ) ) {
+                    SmallVector copy( first, last );
+                    return insert( position, copy.begin(), copy.end() );
+                }
+            }
+
+            if constexpr ( std::forward_iterator<Iterator> ) {
+                size_type count = std::distance( first, last );
+                open_gap( index, count );
+                std::copy( first, last, data_ + index );
+            } else {
+                SmallVector copy( first, last );
+                open_gap( index, copy.size() );
+                std::copy( copy.begin(), copy.end(), data_ + index );
+            }
+            return data_ + index;
+        }
+
+        iterator insert( const_iterator position,
+                         std::initializer_list<T> values ) {
+            return insert( position, values.begin(), values.end() );
+        }
+
+        iterator erase( const_iterator position ) {
+            return erase( position, position + 1 );
+        }
+
+        iterator erase( const_iterator first, const_iterator last ) {
+            size_type index = first - data_;
+            size_type count = last - first;
+            if ( count != 0 ) {
+                std::memmove( data_ + index,
+                              data_ + index + count,
+                              ( size_ - index - count ) * sizeof( T ) );
+                size_ -= count;
+            }
+            return data_ + index;
+        }
+
+        void swap( SmallVector& other ) {
+            SmallVector temporary( std::move( other ) );
+            other = std::move( *this );
+            *this = std::move( temporary );
+        }
+
+        friend bool operator==( const SmallVector& lhs,
+                                const SmallVector& rhs ) {
+            return std::equal( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() );
+        }
+
+    private:
+        static inline thread_local std::pmr::memory_resource* thread_resource =
+            nullptr;
+
+        bool is_inline() const noexcept { return data_ == inline_; }
+
+        T* allocate( size_type count ) {
+            if ( resource_ == nullptr )
+                return std::allocator<T>().allocate( count );
+            return static_cast<T*>(
+                resource_->allocate( count * sizeof( T ), alignof( T ) ) );
+        }
+
+        void deallocate( T* buffer, size_type count ) noexcept {
+            if ( resource_ == nullptr )
+                return std::allocator<T>().deallocate( buffer, count );
+            resource_->deallocate( buffer, count * sizeof( T ), alignof( T ) );
+        }
+
+        bool is_own( const T* pointer ) const noexcept {
+            return !std::less<const T*>()( pointer, data_ ) &&
+                   std::less<const T*>()( pointer, data_ + size_ );
+        }
+
+        void release() noexcept {
+            if ( !is_inline() )
+                deallocate( data_, capacity_ );
+            data_ = inline_;
+            capacity_ = N;
+        }
+
+        // Steals the heap buffer of other, or copies its inline elements,
+        // and leaves other empty.
+        void take( SmallVector& other ) noexcept {
+            if ( other.is_inline() ) {
+                // A fixed size compiles to a few register moves.
+                std::memcpy( inline_, other.inline_, sizeof( inline_ ) );
+            } else {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+            }
+            size_ = other.size_;
+            other.data_ = other.inline_;
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+
+        // Doubles the capacity, so repeated growth stays amortised.
+        void grow( size_type count ) {
+            if ( count <= capacity_ ) return;
+            reserve( is_inline() ? std::max( count, 2 * N )
+                                 : std::max( count, 2 * capacity_ ) );
+        }
+
+        void open_gap( size_type index, size_type count ) {
+            grow( size_ + count );
+            std::memmove( data_ + index + count,
+                          data_ + index,
+                          ( size_ - index ) * sizeof( T ) );
+            size_ += count;
+        }
+
+        std::pmr::memory_resource* resource_ = thread_resource;
+        T* data_ = inline_;
+        size_type size_ = 0;
+        size_type capacity_ = N;
+        T inline_[N];
+    };
+}
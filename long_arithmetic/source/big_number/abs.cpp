@@ -1,3 +1,5 @@
+#include <utility>
+
 #include "big_number.hpp"
 #include "constructors.hpp"
 #include "getters.hpp"
@@ -10,4 +12,19 @@ namespace big_number {
                                 get_error( number ),
                                 false );
     }
+
+    // The mantissa is moved through, so only the sign changes.
+    BigNumber abs( BigNumber&& number ) {
+        return make_big_number( std::move( number.mantissa ),
+                                get_shift( number ),
+                                get_type( number ),
+                                get_error( number ),
+                                false );
+    }
+
+    BigNumberView abs( const BigNumberView& number ) {
+        BigNumberView result = number;
+        result.is_negative = false;
+        return result;
+    }
 }
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <functional>
 #include <utility>
 
 #include "big_number.hpp"
@@ -6,11 +7,12 @@
 #include "constructors.hpp"
 #include "error.hpp"
 #include "getters.hpp"
+#include "natural.hpp"
 
 namespace big_number {
     using range = std::pair<int32_t, size_t>;
 
-    range calculate_range( const BigNumber& a, const BigNumber& b ) {
+    range calculate_range( const BigNumberView& a, const BigNumberView& b ) {
         int32_t min_exp = std::min( get_shift( a ), get_shift( b ) );
         int32_t max_exp =
             std::max( get_shift( a ) + static_cast<int32_t>( get_size( a ) ),
@@ -18,28 +20,52 @@ namespace big_number {
         return { min_exp, static_cast<size_t>( max_exp - min_exp ) };
     }
 
-    BigNumber perform_addition( const BigNumber& lhs, const BigNumber& rhs ) {
+    // The mantissas placed on the result range: low starts at index 0 and
+    // high at offset. The result splits into the part only low covers, a
+    // gap of zeros when the two do not meet, the overlap and the tail of
+    // whichever operand reaches higher.
+    struct Layout {
+        chunks_view low;
+        chunks_view high;
+        size_t offset;
+        size_t low_only;
+        size_t overlap;
+    };
+
+    Layout make_layout( const BigNumberView& low, const BigNumberView& high ) {
+        chunks_view low_mantissa = get_mantissa( low );
+        chunks_view high_mantissa = get_mantissa( high );
+        size_t offset = get_shift( high ) - get_shift( low );
+        size_t low_only = std::min( offset, low_mantissa.size() );
+        size_t overlap = std::min( low_mantissa.size() - low_only,
+                                   high_mantissa.size() );
+        return { low_mantissa, high_mantissa, offset, low_only, overlap };
+    }
+
+    BigNumber perform_addition( const BigNumberView& lhs,
+                                const BigNumberView& rhs ) {
         auto [min_exp, range_size] = calculate_range( lhs, rhs );
+        bool is_lhs_low = get_shift( lhs ) <= get_shift( rhs );
+        auto [low, high, offset, low_only, overlap] =
+            is_lhs_low ? make_layout( lhs, rhs ) : make_layout( rhs, lhs );
 
-        chunks result_chunks( range_size, ZERO_INT );
+        // Room for the carry up front, so pushing it does not reallocate.
+        chunks result_chunks;
         result_chunks.reserve( range_size + ONE_INT );
+        result_chunks.resize( range_size, ZERO_INT );
+        chunks_span result( result_chunks );
 
-        chunk carry = 0;
-
-        for ( size_t i = 0; i < range_size; ++i ) {
-            const int32_t pos = min_exp + static_cast<int32_t>( i );
-            const chunk lhs_chunk = get_shifted_chunk( lhs, pos );
-            const chunk rhs_chunk = get_shifted_chunk( rhs, pos );
-            const chunk sum = lhs_chunk + rhs_chunk + carry;
-
-            if ( sum < MAX_CHUNK ) {
-                result_chunks[i] = sum;
-                carry = ZERO_INT;
-            } else {
-                result_chunks[i] = sum - MAX_CHUNK;
-                carry = ONE_INT;
-            }
-        }
+        std::copy_n( low.begin(), low_only, result.begin() );
+        chunk carry = add_chunks_to( result.subspan( offset, overlap ),
+                                     low.subspan( low_only, overlap ),
+                                     high.first( overlap ),
+                                     ZERO_INT );
+        chunks_view tail = low.size() - low_only > overlap
+                               ? low.subspan( low_only + overlap )
+                               : high.subspan( overlap );
+        carry = propagate_carry( result.subspan( offset + overlap ),
+                                 tail,
+                                 carry );
 
         if ( carry != ZERO_INT ) { result_chunks.push_back( carry ); }
 
@@ -50,27 +76,41 @@ namespace big_number {
                                 is_negative( lhs ) );
     }
 
-    BigNumber perform_subtraction( const BigNumber& lhs,
-                                   const BigNumber& rhs ) {
+    // Needs |lhs| >= |rhs|, so the tail always belongs to lhs.
+    BigNumber perform_subtraction( const BigNumberView& lhs,
+                                   const BigNumberView& rhs ) {
         auto [min_exp, range_size] = calculate_range( lhs, rhs );
-        chunks result_chunks( range_size, 0 );
-        chunk borrow = 0;
-
-        for ( size_t i = 0; i < range_size; ++i ) {
-            const int32_t pos = min_exp + static_cast<int32_t>( i );
-            const chunk minuend = get_shifted_chunk( lhs, pos );
-            const chunk subtrahend_with_borrow =
-                get_shifted_chunk( rhs, pos ) + borrow;
-
-            if ( minuend >= subtrahend_with_borrow ) {
-                result_chunks[i] = minuend - subtrahend_with_borrow;
-                borrow = 0;
-            } else {
-                result_chunks[i] = MAX_CHUNK + minuend - subtrahend_with_borrow;
-                borrow = 1;
-            }
+        bool is_lhs_low = get_shift( lhs ) <= get_shift( rhs );
+        auto [low, high, offset, low_only, overlap] =
+            is_lhs_low ? make_layout( lhs, rhs ) : make_layout( rhs, lhs );
+
+        chunks result_chunks( range_size, ZERO_INT );
+        chunks_span result( result_chunks );
+
+        chunk borrow = ZERO_INT;
+        if ( is_lhs_low ) {
+            std::copy_n( low.begin(), low_only, result.begin() );
+        } else {
+            borrow = negate_chunks_to( result.first( low_only ),
+                                       low.first( low_only ) );
+            std::fill( result.begin() + low_only,
+                       result.begin() + offset,
+                       borrow * ALMOST_MAX_CHUNK );
         }
 
+        chunks_view low_overlap = low.subspan( low_only, overlap );
+        chunks_view high_overlap = high.first( overlap );
+        borrow = sub_chunks_to( result.subspan( offset, overlap ),
+                                is_lhs_low ? low_overlap : high_overlap,
+                                is_lhs_low ? high_overlap : low_overlap,
+                                borrow );
+        chunks_view tail = is_lhs_low ? low.subspan( low_only + overlap )
+                                      : high.subspan( overlap );
+        propagate_borrow( result.subspan( offset + overlap ), tail, borrow );
+
+        // normalize() only drops low zero chunks; high ones left by the
+        // borrow would make the value non-canonical.
+        result_chunks.resize( trim_chunks( result_chunks ).size() );
         return make_big_number( std::move( result_chunks ),
                                 min_exp,
                                 BigNumberType::DEFAULT,
@@ -78,14 +118,14 @@ namespace big_number {
                                 is_negative( lhs ) );
     }
 
-    BigNumber handle_add_to_inf( const BigNumber& lhs,
-                                 const BigNumber& rhs,
+    BigNumber handle_add_to_inf( const BigNumberView& lhs,
+                                 const BigNumberView& rhs,
                                  const Error& error ) {
         switch ( get_type( rhs ) ) {
         case BigNumberType::DEFAULT:
-            return lhs;
+            return make_big_number( lhs );
         case BigNumberType::ZERO:
-            return lhs;
+            return make_big_number( lhs );
         case BigNumberType::NOT_A_NUMBER:
             return make_nan( error );
         case BigNumberType::INF:
@@ -95,8 +135,8 @@ namespace big_number {
         }
     }
 
-    BigNumber handle_special_addition( const BigNumber& lhs,
-                                       const BigNumber& rhs ) {
+    BigNumber handle_special_addition( const BigNumberView& lhs,
+                                       const BigNumberView& rhs ) {
         if ( !is_special( lhs ) && is_special( rhs ) )
             return handle_special_addition( rhs, lhs );
 
@@ -104,7 +144,7 @@ namespace big_number {
 
         switch ( get_type( lhs ) ) {
         case BigNumberType::ZERO:
-            return rhs;
+            return make_big_number( rhs );
         case BigNumberType::INF:
             return handle_add_to_inf( lhs, rhs, error );
         case BigNumberType::NOT_A_NUMBER:
@@ -114,8 +154,8 @@ namespace big_number {
         }
     }
 
-    BigNumber handle_sub_from_inf( const BigNumber& lhs,
-                                   const BigNumber& rhs,
+    BigNumber handle_sub_from_inf( const BigNumberView& lhs,
+                                   const BigNumberView& rhs,
                                    const Error& error ) {
         switch ( get_type( rhs ) ) {
         case BigNumberType::DEFAULT:
@@ -131,8 +171,8 @@ namespace big_number {
         }
     }
 
-    BigNumber handle_sub_from_zero( const BigNumber& lhs,
-                                    const BigNumber& rhs,
+    BigNumber handle_sub_from_zero( const BigNumberView& lhs,
+                                    const BigNumberView& rhs,
                                     const Error& error ) {
         switch ( get_type( rhs ) ) {
         case BigNumberType::ZERO:
@@ -142,12 +182,12 @@ namespace big_number {
         case BigNumberType::INF:
             return make_inf( error, !is_negative( rhs ) );
         case BigNumberType::DEFAULT:
-            return neg( rhs );
+            return make_big_number( neg( rhs ) );
         }
     }
 
-    BigNumber handle_special_subtraction( const BigNumber& lhs,
-                                          const BigNumber& rhs ) {
+    BigNumber handle_special_subtraction( const BigNumberView& lhs,
+                                          const BigNumberView& rhs ) {
         if ( !is_special( lhs ) && is_special( rhs ) )
             return neg( handle_special_subtraction( rhs, lhs ) );
 
@@ -165,8 +205,7 @@ namespace big_number {
         }
     }
 
-    BigNumber add( const BigNumber& lhs, const BigNumber& rhs ) {
-        if ( &lhs == &rhs ) return perform_addition( lhs, lhs );
+    BigNumber add( const BigNumberView& lhs, const BigNumberView& rhs ) {
         if ( is_special( lhs ) || is_special( rhs ) )
             return handle_special_addition( lhs, rhs );
 
@@ -174,17 +213,118 @@ namespace big_number {
         return perform_addition( lhs, rhs );
     }
 
-    BigNumber sub( const BigNumber& lhs, const BigNumber& rhs ) {
-        if ( &lhs == &rhs ) return make_zero( propagate_error( lhs, rhs ) );
-
+    BigNumber sub( const BigNumberView& lhs, const BigNumberView& rhs ) {
         if ( is_special( lhs ) || is_special( rhs ) )
             return handle_special_subtraction( lhs, rhs );
 
         if ( !has_same_sign( lhs, rhs ) ) return add( lhs, neg( rhs ) );
 
-        if ( is_lower_than( abs( lhs ), abs( rhs ) ) )
-            return neg( sub( rhs, lhs ) );
+        int order = compare_abs( lhs, rhs );
+        if ( order == ZERO_INT )
+            return make_zero( propagate_error( lhs, rhs ) );
+        if ( order < ZERO_INT ) return neg( perform_subtraction( rhs, lhs ) );
 
         return perform_subtraction( lhs, rhs );
     }
+
+    BigNumber add( const BigNumber& lhs, const BigNumber& rhs ) {
+        if ( &lhs == &rhs && !is_special( lhs ) )
+            return perform_addition( make_view( lhs ), make_view( lhs ) );
+        return add( make_view( lhs ), make_view( rhs ) );
+    }
+
+    BigNumber sub( const BigNumber& lhs, const BigNumber& rhs ) {
+        if ( &lhs == &rhs && !is_special( lhs ) )
+            return make_zero( propagate_error( lhs, rhs ) );
+        return sub( make_view( lhs ), make_view( rhs ) );
+    }
+
+    // True when the view reads the mantissa that the in-place paths are
+    // about to overwrite.
+    bool is_aliased( const BigNumber& number, const BigNumberView& view ) {
+        std::less<const chunk*> is_before;
+        const chunk* first = number.mantissa.data();
+        const chunk* last = first + number.mantissa.size();
+        std::span<const chunk> mantissa = get_mantissa( view );
+        return is_before( mantissa.data(), last ) &&
+               is_before( first, mantissa.data() + mantissa.size() );
+    }
+
+    // acc becomes acc + value for two regular numbers. The mantissa of acc
+    // is widened in place to the union of both ranges, so its capacity is
+    // reused and only the chunks under value and the carry tail change.
+    void accumulate( BigNumber& acc, const BigNumberView& value ) {
+        BigNumberView acc_view = make_view( acc );
+        const Error error = propagate_error( acc_view, value );
+        auto [min_exp, range_size] = calculate_range( acc_view, value );
+        bool is_subtraction = !has_same_sign( acc_view, value );
+        bool is_reversed =
+            is_subtraction && compare_abs( acc_view, value ) < ZERO_INT;
+        bool is_result_negative = is_negative( acc ) != is_reversed;
+
+        chunks& mantissa = acc.mantissa;
+        mantissa.insert(
+            mantissa.begin(), get_shift( acc ) - min_exp, ZERO_INT );
+        mantissa.resize( range_size, ZERO_INT );
+        chunks_span target( mantissa );
+        chunks_span window = target.subspan( get_shift( value ) - min_exp );
+
+        if ( !is_subtraction ) {
+            chunk carry = add_chunks_into( window, get_mantissa( value ) );
+            if ( carry != ZERO_INT ) mantissa.push_back( carry );
+        } else if ( !is_reversed ) {
+            sub_chunks_into( window, get_mantissa( value ) );
+        } else {
+            // value - acc as value + ( B^n - acc ) - B^n, where B^n - acc is
+            // the chunkwise complement plus one; the final carry is B^n.
+            const chunk one = ONE_INT;
+            for ( chunk& current : target ) {
+                current = ALMOST_MAX_CHUNK - current;
+            }
+            add_chunks_into( target, { &one, ONE_INT } );
+            add_chunks_into( window, get_mantissa( value ) );
+        }
+
+        // A subtraction can cancel the top chunks, which normalize() keeps.
+        if ( is_subtraction ) mantissa.resize( trim_chunks( mantissa ).size() );
+        acc = make_big_number( std::move( mantissa ),
+                               min_exp,
+                               BigNumberType::DEFAULT,
+                               error,
+                               is_result_negative );
+    }
+
+    void add_assign( BigNumber& acc, const BigNumberView& value ) {
+        if ( is_special( acc ) || is_special( value ) ||
+             is_aliased( acc, value ) ) {
+            acc = add( make_view( acc ), value );
+            return;
+        }
+        accumulate( acc, value );
+    }
+
+    void sub_assign( BigNumber& acc, const BigNumberView& value ) {
+        if ( is_special( acc ) || is_special( value ) ||
+             is_aliased( acc, value ) ) {
+            acc = sub( make_view( acc ), value );
+            return;
+        }
+        accumulate( acc, neg( value ) );
+    }
+
+    void add_assign( BigNumber& acc, const BigNumber& value ) {
+        if ( &acc == &value ) {
+            acc = add( acc, value );
+            return;
+        }
+        add_assign( acc, make_view( value ) );
+    }
+
+    void sub_assign( BigNumber& acc, const BigNumber& value ) {
+        if ( &acc == &value ) {
+            acc = sub( acc, value );
+            return;
+        }
+        sub_assign( acc, make_view( value ) );
+    }
 }
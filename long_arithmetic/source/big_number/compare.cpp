@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+
+#include "big_number.hpp"
+#include "getters.hpp"
+
+namespace big_number {
+    // Position of a value on the number line, with NaN above everything so
+    // that sorting sees a total order.
+    int get_rank( const BigNumberView& number ) {
+        switch ( get_type( number ) ) {
+        case BigNumberType::ZERO:
+            return 0;
+        case BigNumberType::DEFAULT:
+            return is_negative( number ) ? -1 : 1;
+        case BigNumberType::INF:
+            return is_negative( number ) ? -2 : 2;
+        default:
+            return 3;
+        }
+    }
+
+    int get_abs_rank( const BigNumberView& number ) {
+        return std::abs( get_rank( number ) );
+    }
+
+    int compare_ranks( int lhs_rank, int rhs_rank ) {
+        return ( lhs_rank > rhs_rank ) - ( lhs_rank < rhs_rank );
+    }
+
+    // Both numbers are finite and non-zero. Equal powers align the top
+    // chunks; past the shorter mantissa the longer one only has more
+    // non-zero chunks.
+    int compare_magnitudes( const BigNumberView& lhs,
+                            const BigNumberView& rhs ) {
+        int32_t lhs_power = count_power( lhs );
+        int32_t rhs_power = count_power( rhs );
+        if ( lhs_power != rhs_power ) return lhs_power < rhs_power ? -1 : 1;
+
+        std::span<const chunk> lhs_mantissa = get_mantissa( lhs );
+        std::span<const chunk> rhs_mantissa = get_mantissa( rhs );
+        size_t lhs_size = lhs_mantissa.size();
+        size_t rhs_size = rhs_mantissa.size();
+        size_t min_size = std::min( lhs_size, rhs_size );
+
+        for ( size_t delta = 1; delta <= min_size; delta++ ) {
+            chunk lhs_chunk = lhs_mantissa[lhs_size - delta];
+            chunk rhs_chunk = rhs_mantissa[rhs_size - delta];
+            if ( lhs_chunk != rhs_chunk ) return lhs_chunk < rhs_chunk ? -1 : 1;
+        }
+
+        return ( lhs_size > rhs_size ) - ( lhs_size < rhs_size );
+    }
+
+    int compare( const BigNumberView& lhs, const BigNumberView& rhs ) {
+        int lhs_rank = get_rank( lhs );
+        int rhs_rank = get_rank( rhs );
+        if ( lhs_rank != rhs_rank ) return compare_ranks( lhs_rank, rhs_rank );
+        if ( is_special( lhs ) ) return 0;
+
+        int order = compare_magnitudes( lhs, rhs );
+        return is_negative( lhs ) ? -order : order;
+    }
+
+    int compare_abs( const BigNumberView& lhs, const BigNumberView& rhs ) {
+        int lhs_rank = get_abs_rank( lhs );
+        int rhs_rank = get_abs_rank( rhs );
+        if ( lhs_rank != rhs_rank ) return compare_ranks( lhs_rank, rhs_rank );
+        if ( is_special( lhs ) ) return 0;
+
+        return compare_magnitudes( lhs, rhs );
+    }
+
+    int compare( const BigNumber& lhs, const BigNumber& rhs ) {
+        return compare( make_view( lhs ), make_view( rhs ) );
+    }
+
+    int compare_abs( const BigNumber& lhs, const BigNumber& rhs ) {
+        return compare_abs( make_view( lhs ), make_view( rhs ) );
+    }
+}
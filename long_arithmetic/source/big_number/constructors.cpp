@@ -1,5 +1,7 @@
 #include "constructors.hpp"
 
+#include <algorithm>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "error.hpp"
@@ -68,19 +70,21 @@ namespace big_number {
         return make_zero( make_error( ErrorCode::ERROR ) );
     }
 
-    chunks remove_leading_zeros( const chunks& value ) {
+    void remove_leading_zeros( chunks& value ) {
         auto first_non_zero =
             std::ranges::find_if( value.begin(), value.end(), []( chunk c ) {
                 return c != ZERO_INT;
             } );
-        return chunks( first_non_zero, value.end() );
+        value.erase( value.begin(), first_non_zero );
     }
 
-    chunks normalize( const chunks& raw_mantissa ) {
-        chunks value = remove_leading_zeros( raw_mantissa );
-        if ( raw_mantissa.size() <= MAX_CHUNKS ) return value;
+    chunks normalize( chunks value ) {
+        size_t raw_size = value.size();
+        chunk last_chunk = raw_size > MAX_CHUNKS ? value[MAX_CHUNKS] : 0;
+
+        remove_leading_zeros( value );
+        if ( raw_size <= MAX_CHUNKS ) return value;
 
-        chunk last_chunk = raw_mantissa[MAX_CHUNKS];
         size_t counter = value.size() - MAX_CHUNKS;
 
         if ( last_chunk >= HALF_CHUNK ) {
@@ -100,26 +104,33 @@ namespace big_number {
     }
 
     int32_t normalize( int32_t raw_shift,
-                       const chunks& raw_mantissa,
+                       size_t raw_size,
                        const chunks& norm_mantissa ) {
-        size_t delta = raw_mantissa.size() - norm_mantissa.size();
+        size_t delta = raw_size - norm_mantissa.size();
         if ( delta >= MAX_SHIFT ) return MAX_SHIFT + 1;
         return raw_shift + delta;
     }
 
-    BigNumber normalize( const chunks& mantissa,
+    // The mantissa is taken by value and moved through, so a temporary
+    // product becomes the result without being copied.
+    BigNumber normalize( chunks mantissa,
                          int32_t shift,
                          BigNumberType type,
                          const Error& error,
                          bool is_negative ) {
-        chunks norm_mantissa = normalize( mantissa );
-        int32_t norm_shift = normalize( shift, mantissa, norm_mantissa );
+        size_t raw_size = mantissa.size();
+        chunks norm_mantissa = normalize( std::move( mantissa ) );
+        int32_t norm_shift = normalize( shift, raw_size, norm_mantissa );
 
         if ( is_out_of_bounds( norm_mantissa, norm_shift ) )
             return make_special(
                 norm_mantissa, norm_shift, type, error, is_negative );
 
-        return { norm_mantissa, norm_shift, type, error, is_negative };
+        return { std::move( norm_mantissa ),
+                 norm_shift,
+                 type,
+                 error,
+                 is_negative };
     }
 
     BigNumber make_big_number( chunks mantissa,
@@ -130,6 +141,24 @@ namespace big_number {
         if ( is_special( type ) )
             return make_special( mantissa, shift, type, error, is_negative );
 
-        return normalize( mantissa, shift, type, error, is_negative );
+        return normalize(
+            std::move( mantissa ), shift, type, error, is_negative );
+    }
+
+    BigNumberView make_view( const BigNumber& number ) {
+        return { number.mantissa,
+                 number.shift,
+                 number.type,
+                 number.error,
+                 number.is_negative };
+    }
+
+    BigNumber make_big_number( const BigNumberView& view ) {
+        return make_big_number( chunks( view.mantissa.begin(),
+                                        view.mantissa.end() ),
+                                view.shift,
+                                view.type,
+                                view.error,
+                                view.is_negative );
     }
 }
@@ -0,0 +1,441 @@
+#include "div.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "constructors.hpp"
+#include "getters.hpp"
+#include "mul.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    constexpr std::array<chunk, 1> UNIT = { ONE_INT };
+
+    // floor( 2^123 / MAX_CHUNK ) still fits in 64 bits, so a value below
+    // MAX_CHUNK^2 is split with two multiplications instead of a 128-bit
+    // division.
+    constexpr int RECIPROCAL_SHIFT = 123;
+    constexpr chunk CHUNK_RECIPROCAL = static_cast<chunk>(
+        ( static_cast<mul_chunk>( 1 ) << RECIPROCAL_SHIFT ) / MAX_CHUNK );
+
+    // Returns value / MAX_CHUNK and stores value % MAX_CHUNK in low. The
+    // fixed-point estimate is at most one below the quotient.
+    inline chunk split_chunk_product( mul_chunk value, chunk& low ) {
+        chunk value_high = static_cast<chunk>( value >> 64 );
+        chunk value_low = static_cast<chunk>( value );
+        mul_chunk scaled =
+            static_cast<mul_chunk>( value_high ) * CHUNK_RECIPROCAL +
+            ( ( static_cast<mul_chunk>( value_low ) * CHUNK_RECIPROCAL ) >>
+              64 );
+        chunk quotient =
+            static_cast<chunk>( scaled >> ( RECIPROCAL_SHIFT - 64 ) );
+
+        low = value_low - quotient * MAX_CHUNK;
+        chunk overshoot = low >= MAX_CHUNK;
+        low -= overshoot * MAX_CHUNK;
+        return quotient + overshoot;
+    }
+
+    // target -= value * factor, where target has one chunk more than value;
+    // returns the borrow out of the top chunk. The high half of each
+    // product joins the next column, so the products do not wait on a
+    // carry and the borrow can reach two.
+    chunk
+    sub_multiple_into( chunks_span target, chunks_view value, chunk factor ) {
+        chunk high = 0;
+        chunk borrow = 0;
+
+        for ( size_t i = 0; i < value.size(); ++i ) {
+            chunk low;
+            chunk next_high = split_chunk_product(
+                static_cast<mul_chunk>( value[i] ) * factor, low );
+            chunk subtrahend = low + high + borrow;
+            borrow = ( target[i] < subtrahend ) +
+                     ( target[i] + MAX_CHUNK < subtrahend );
+            target[i] = target[i] + borrow * MAX_CHUNK - subtrahend;
+            high = next_high;
+        }
+
+        chunk& top = target[value.size()];
+        chunk subtrahend = high + borrow;
+        borrow = top < subtrahend;
+        top = top + borrow * MAX_CHUNK - subtrahend;
+        return borrow;
+    }
+
+    // Knuth's algorithm D. With the divisor's top chunk at least HALF_CHUNK
+    // the estimate from the top two chunks is at most two too large, and
+    // the test against the next chunk removes almost every overshoot.
+    void schoolbook_div_into( chunks_span remainder,
+                              chunks_view divisor,
+                              chunks_span quotient ) {
+        size_t size = divisor.size();
+        chunk top = divisor[size - ONE_INT];
+        chunk next = divisor[size - 2];
+
+        for ( size_t j = quotient.size(); j-- > ZERO_INT; ) {
+            chunks_span window = remainder.subspan( j, size + ONE_INT );
+            mul_chunk head =
+                static_cast<mul_chunk>( window[size] ) * MAX_CHUNK +
+                window[size - ONE_INT];
+            mul_chunk estimate = head / top;
+            mul_chunk rest = head - estimate * top;
+
+            while ( estimate >= MAX_CHUNK ||
+                    estimate * next > rest * MAX_CHUNK + window[size - 2] ) {
+                --estimate;
+                rest += top;
+                if ( rest >= MAX_CHUNK ) break;
+            }
+
+            chunk digit = static_cast<chunk>( estimate );
+            if ( sub_multiple_into( window, divisor, digit ) != ZERO_INT ) {
+                --digit;
+                add_chunks_into( window, divisor );
+            }
+            quotient[j] = digit;
+        }
+    }
+
+    // Turns an estimate a few units away from window / divisor into the
+    // exact quotient and leaves the remainder in window. The estimate has a
+    // spare top chunk.
+    void correct_quotient( chunks_span window,
+                           chunks_view divisor,
+                           chunks_span estimate ) {
+        chunks_view trimmed = trim_chunks( estimate );
+        chunks product( trimmed.size() + divisor.size() );
+        multiply_into( trimmed, divisor, product );
+
+        while ( compare_chunks( product, window ) > 0 ) {
+            sub_chunks_into( product, divisor );
+            sub_chunks_into( estimate, UNIT );
+        }
+        sub_chunks_into( window, trim_chunks( product ) );
+
+        while ( compare_chunks( window, divisor ) >= 0 ) {
+            sub_chunks_into( window, divisor );
+            add_chunks_into( estimate, UNIT );
+        }
+    }
+
+    // Newton's iteration x += x * ( 1 - divisor * x ) doubles the number of
+    // correct chunks, so the reciprocal of the top half of the divisor is
+    // refined with one product at full length and one at half length.
+    chunks invert_chunks( chunks_view divisor ) {
+        size_t size = divisor.size();
+        chunks reciprocal( size + 2, ZERO_INT );
+
+        if ( size < DIV_NEWTON_THRESHOLD ) {
+            chunks power( 2 * size + ONE_INT, ZERO_INT );
+            power.back() = ONE_INT;
+            schoolbook_div_into(
+                power, divisor, chunks_span( reciprocal ).first( size + 1 ) );
+            reciprocal.resize( size + ONE_INT );
+            return reciprocal;
+        }
+
+        size_t half = size / 2 + ONE_INT;
+        chunks head_reciprocal = invert_chunks( divisor.last( half ) );
+        chunks_view head = trim_chunks( head_reciprocal );
+
+        // The error of the head against MAX_CHUNK^( size + half ), whose
+        // low half - 1 chunks are below the precision of the update.
+        chunks error( size + half + 2, ZERO_INT );
+        multiply_into( divisor,
+                       head,
+                       chunks_span( error ).first( size + head.size() ) );
+
+        bool is_excess =
+            compare_chunks( chunks_view( error ).subspan( size + half ),
+                            UNIT ) >= 0;
+        if ( is_excess ) {
+            sub_chunks_into( chunks_span( error ).subspan( size + half ),
+                             UNIT );
+        } else {
+            chunks power( size + half + ONE_INT, ZERO_INT );
+            power.back() = ONE_INT;
+            sub_chunks_into( power, trim_chunks( error ) );
+            error = std::move( power );
+        }
+
+        chunks_view error_head =
+            trim_chunks( chunks_view( error ).subspan( half - ONE_INT ) );
+        chunks update( head.size() + error_head.size() );
+        multiply_into( head, error_head, update );
+        chunks_view correction = trim_chunks(
+            chunks_view( update ).subspan( std::min( half + ONE_INT,
+                                                     update.size() ) ) );
+
+        std::ranges::copy( head, reciprocal.begin() + ( size - half ) );
+        if ( is_excess ) {
+            sub_chunks_into( reciprocal, correction );
+            sub_chunks_into( reciprocal, UNIT );
+        } else {
+            add_chunks_into( reciprocal, correction );
+        }
+
+        reciprocal.resize( size + ONE_INT );
+        return reciprocal;
+    }
+
+    // The quotient of a window of at most 2n chunks is estimated from its
+    // top chunks times the reciprocal and then corrected.
+    void newton_div_block( chunks_span window,
+                           chunks_view divisor,
+                           chunks_view reciprocal,
+                           chunks_span quotient ) {
+        size_t size = divisor.size();
+        size_t length = quotient.size();
+        size_t cut = length < size ? size - length - ONE_INT : ZERO_INT;
+
+        chunks_view head = chunks_view( window ).subspan( size - ONE_INT );
+        chunks_view scale = reciprocal.subspan( cut );
+        chunks product( head.size() + scale.size() );
+        multiply_into( head, scale, product );
+
+        chunks estimate( product.begin() + ( size + ONE_INT - cut ),
+                         product.end() );
+        correct_quotient( window, divisor, estimate );
+        std::ranges::copy_n( estimate.begin(), length, quotient.begin() );
+    }
+
+    // A divisor much longer than the quotient only matters through its top
+    // quotient.size() + 1 chunks up to a unit of the quotient, otherwise the
+    // dividend is divided in blocks of n quotient chunks.
+    void newton_div_into( chunks_span remainder,
+                          chunks_view divisor,
+                          chunks_span quotient ) {
+        size_t size = divisor.size();
+        size_t length = quotient.size();
+
+        if ( length + ONE_INT < size ) {
+            size_t cut = size - length - ONE_INT;
+            chunks head( remainder.begin() + cut, remainder.end() );
+            head.push_back( ZERO_INT );
+            chunks estimate( length + ONE_INT );
+
+            divide_normalized_into( head, divisor.subspan( cut ), estimate );
+            correct_quotient( remainder, divisor, estimate );
+            std::ranges::copy_n( estimate.begin(), length, quotient.begin() );
+            return;
+        }
+
+        chunks reciprocal = invert_chunks( divisor );
+        for ( size_t end = length; end > ZERO_INT; ) {
+            size_t block = std::min( size, end );
+            end -= block;
+            newton_div_block( remainder.subspan( end, block + size ),
+                              divisor,
+                              reciprocal,
+                              quotient.subspan( end, block ) );
+        }
+    }
+
+    void divide_normalized_into( chunks_span remainder,
+                                 chunks_view divisor,
+                                 chunks_span quotient ) {
+        if ( divisor.size() < DIV_NEWTON_THRESHOLD )
+            return schoolbook_div_into( remainder, divisor, quotient );
+        return newton_div_into( remainder, divisor, quotient );
+    }
+
+    ChunksDivision divide_chunks( chunks_view dividend, chunks_view divisor ) {
+        dividend = trim_chunks( dividend );
+        divisor = trim_chunks( divisor );
+
+        if ( compare_chunks( dividend, divisor ) < 0 )
+            return { {}, chunks( dividend.begin(), dividend.end() ) };
+
+        if ( divisor.size() == ONE_INT ) {
+            chunks quotient( dividend.begin(), dividend.end() );
+            chunk rest = div_chunks_small( quotient, divisor.front() );
+            quotient.resize( trim_chunks( quotient ).size() );
+            if ( rest == ZERO_INT ) return { std::move( quotient ), {} };
+            return { std::move( quotient ), { rest } };
+        }
+
+        // Scaling both operands keeps the quotient and lifts the top chunk
+        // of the divisor to at least HALF_CHUNK.
+        chunk factor = MAX_CHUNK / ( divisor.back() + ONE_INT );
+        chunks remainder = mul_chunks_small( dividend, factor );
+        chunks scaled = mul_chunks_small( divisor, factor );
+        remainder.resize( dividend.size() + ONE_INT, ZERO_INT );
+        chunks quotient( remainder.size() - scaled.size() );
+
+        divide_normalized_into( remainder, scaled, quotient );
+
+        remainder.resize( scaled.size() );
+        div_chunks_small( remainder, factor );
+        quotient.resize( trim_chunks( quotient ).size() );
+        remainder.resize( trim_chunks( remainder ).size() );
+        return { std::move( quotient ), std::move( remainder ) };
+    }
+
+    // Keeps the top MAX_CHUNKS chunks of value, which truncates it toward
+    // zero.
+    BigNumber make_truncated( chunks value,
+                              int32_t shift,
+                              const Error& error,
+                              bool is_negative ) {
+        size_t excess = value.size() - std::min( value.size(), MAX_CHUNKS );
+        value.erase( value.begin(), value.begin() + excess );
+
+        return make_big_number( std::move( value ),
+                                shift + static_cast<int32_t>( excess ),
+                                BigNumberType::DEFAULT,
+                                error,
+                                is_negative );
+    }
+
+    // The dividend is padded with zero chunks, or cut, so that the quotient
+    // gets MAX_CHUNKS chunks without reaching below -MAX_SHIFT. Cutting low
+    // dividend chunks does not change the truncated quotient.
+    BigNumber divide( const BigNumber& dividend, const BigNumber& divisor ) {
+        const chunks& mantissa = get_mantissa( dividend );
+        int32_t shift = get_shift( dividend ) - get_shift( divisor );
+        int32_t padding = static_cast<int32_t>( MAX_CHUNKS ) +
+                          static_cast<int32_t>( get_size( divisor ) ) -
+                          static_cast<int32_t>( mantissa.size() );
+        padding = std::min( padding, shift + MAX_SHIFT );
+
+        chunks numerator;
+        if ( padding >= 0 ) {
+            numerator.reserve( padding + mantissa.size() );
+            numerator.resize( padding, ZERO_INT );
+            numerator.insert(
+                numerator.end(), mantissa.begin(), mantissa.end() );
+        } else if ( static_cast<size_t>( -padding ) < mantissa.size() ) {
+            numerator.assign( mantissa.begin() - padding, mantissa.end() );
+        }
+
+        return make_truncated(
+            divide_chunks( numerator, get_mantissa( divisor ) ).quotient,
+            shift - padding,
+            propagate_error( dividend, divisor ),
+            !has_same_sign( dividend, divisor ) );
+    }
+
+    BigNumber div_zero( const BigNumber& rhs, const Error& error ) {
+        switch ( get_type( rhs ) ) {
+        case BigNumberType::DEFAULT:
+        case BigNumberType::INF:
+            return make_zero( error );
+        default:
+            return make_nan( error );
+        }
+    }
+
+    BigNumber
+    div_inf( const BigNumber& lhs, const BigNumber& rhs, const Error& error ) {
+        switch ( get_type( rhs ) ) {
+        case BigNumberType::DEFAULT:
+        case BigNumberType::ZERO:
+            return make_inf( error, !has_same_sign( lhs, rhs ) );
+        default:
+            return make_nan( error );
+        }
+    }
+
+    BigNumber div_by_special( const BigNumber& lhs,
+                              const BigNumber& rhs,
+                              const Error& error ) {
+        switch ( get_type( rhs ) ) {
+        case BigNumberType::ZERO:
+            return make_inf( error, !has_same_sign( lhs, rhs ) );
+        case BigNumberType::INF:
+            return make_zero( error );
+        case BigNumberType::DEFAULT:
+            return divide( lhs, rhs );
+        default:
+            return make_nan( error );
+        }
+    }
+
+    BigNumber div_special( const BigNumber& lhs, const BigNumber& rhs ) {
+        const Error error = propagate_error( lhs, rhs );
+
+        switch ( get_type( lhs ) ) {
+        case BigNumberType::INF:
+            return div_inf( lhs, rhs, error );
+        case BigNumberType::ZERO:
+            return div_zero( rhs, error );
+        case BigNumberType::DEFAULT:
+            return div_by_special( lhs, rhs, error );
+        default:
+            return make_nan( error );
+        }
+    }
+
+    chunks shift_chunks( const chunks& value, int32_t shift ) {
+        chunks result( shift, ZERO_INT );
+        result.insert( result.end(), value.begin(), value.end() );
+        return result;
+    }
+
+    // Both operands are brought to the lower of the two shifts, so the
+    // quotient is an integer and the remainder keeps the dividend's sign.
+    // Either is truncated like a div() quotient when it has more than
+    // MAX_CHUNKS chunks.
+    DivRem divide_with_remainder( const BigNumber& dividend,
+                                  const BigNumber& divisor ) {
+        const Error error = propagate_error( dividend, divisor );
+        int32_t shift =
+            std::min( get_shift( dividend ), get_shift( divisor ) );
+        chunks numerator = shift_chunks( get_mantissa( dividend ),
+                                         get_shift( dividend ) - shift );
+        chunks denominator = shift_chunks( get_mantissa( divisor ),
+                                           get_shift( divisor ) - shift );
+
+        auto [quotient, remainder] = divide_chunks( numerator, denominator );
+        return { make_truncated( std::move( quotient ),
+                                 ZERO_INT,
+                                 error,
+                                 !has_same_sign( dividend, divisor ) ),
+                 make_truncated( std::move( remainder ),
+                                 shift,
+                                 error,
+                                 is_negative( dividend ) ) };
+    }
+
+    // A finite dividend is its own remainder modulo infinity.
+    BigNumber rem_special( const BigNumber& lhs, const BigNumber& rhs ) {
+        const Error error = propagate_error( lhs, rhs );
+
+        if ( is_nan( lhs ) || is_nan( rhs ) ) return make_nan( error );
+        if ( is_inf( lhs ) || is_zero( rhs ) ) return make_nan( error );
+        if ( is_zero( lhs ) ) return make_zero( error );
+
+        return make_big_number( get_mantissa( lhs ),
+                                get_shift( lhs ),
+                                BigNumberType::DEFAULT,
+                                error,
+                                is_negative( lhs ) );
+    }
+
+    BigNumber div( const BigNumber& dividend, const BigNumber& divisor ) {
+        if ( is_special( dividend ) || is_special( divisor ) )
+            return div_special( dividend, divisor );
+
+        return divide( dividend, divisor );
+    }
+
+    BigNumber inv( const BigNumber& number ) {
+        BigNumber one = make_big_number( { ONE_INT },
+                                         ZERO_INT,
+                                         BigNumberType::DEFAULT,
+                                         get_error( number ),
+                                         false );
+        return div( one, number );
+    }
+
+    DivRem div_rem( const BigNumber& dividend, const BigNumber& divisor ) {
+        if ( is_special( dividend ) || is_special( divisor ) )
+            return { div_special( dividend, divisor ),
+                     rem_special( dividend, divisor ) };
+
+        return divide_with_remainder( dividend, divisor );
+    }
+}
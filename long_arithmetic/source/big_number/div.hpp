@@ -0,0 +1,36 @@
+#pragma once
+
+#include "big_number.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    // Smallest divisor size (in chunks) at which the Newton reciprocal
+    // beats schoolbook division, see the DivRemainder benchmarks.
+    constexpr size_t DIV_NEWTON_THRESHOLD = 150;
+
+    struct ChunksDivision {
+        chunks quotient;
+        chunks remainder;
+    };
+
+    ChunksDivision divide_chunks( chunks_view dividend, chunks_view divisor );
+
+    // The helpers below take a divisor of n >= 2 chunks whose top chunk is
+    // at least HALF_CHUNK. remainder holds the dividend on entry and the
+    // remainder on exit; it has quotient.size() + n chunks and its top n
+    // chunks are below the divisor.
+    void divide_normalized_into( chunks_span remainder,
+                                 chunks_view divisor,
+                                 chunks_span quotient );
+
+    void schoolbook_div_into( chunks_span remainder,
+                              chunks_view divisor,
+                              chunks_span quotient );
+
+    void newton_div_into( chunks_span remainder,
+                          chunks_view divisor,
+                          chunks_span quotient );
+
+    // About MAX_CHUNK^( 2n ) / divisor, a few units off, in n + 1 chunks.
+    chunks invert_chunks( chunks_view divisor );
+}
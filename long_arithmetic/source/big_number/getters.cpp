@@ -29,7 +29,8 @@ namespace big_number {
     chunk get_shifted_chunk( const BigNumber& number, int32_t index ) {
         int32_t chunk_index = index - get_shift( number );
 
-        if ( chunk_index < ZERO_INT || chunk_index >= get_size( number ) )
+        if ( chunk_index < ZERO_INT ||
+             static_cast<size_t>( chunk_index ) >= get_size( number ) )
             return ZERO_INT;
 
         return get_mantissa( number )[chunk_index];
@@ -64,4 +65,67 @@ namespace big_number {
         const Error& err_b = get_error( rhs );
         return !is_ok( err_a ) ? err_a : err_b;
     }
+
+    const Error& get_error( const BigNumberView& number ) {
+        return number.error;
+    }
+
+    int32_t get_shift( const BigNumberView& number ) { return number.shift; }
+
+    size_t get_size( const BigNumberView& number ) {
+        return number.mantissa.size();
+    }
+
+    BigNumberType get_type( const BigNumberView& number ) {
+        return number.type;
+    }
+
+    std::span<const chunk> get_mantissa( const BigNumberView& number ) {
+        return number.mantissa;
+    }
+
+    chunk get_shifted_chunk( const BigNumberView& number, int32_t index ) {
+        int32_t chunk_index = index - get_shift( number );
+
+        if ( chunk_index < ZERO_INT ||
+             static_cast<size_t>( chunk_index ) >= get_size( number ) )
+            return ZERO_INT;
+
+        return get_mantissa( number )[chunk_index];
+    }
+
+    int32_t count_power( const BigNumberView& number ) {
+        return static_cast<int32_t>( get_size( number ) ) + get_shift( number );
+    }
+
+    bool is_negative( const BigNumberView& number ) {
+        return number.is_negative;
+    }
+
+    bool is_zero( const BigNumberView& number ) {
+        return get_type( number ) == BigNumberType::ZERO;
+    }
+
+    bool is_inf( const BigNumberView& number ) {
+        return get_type( number ) == BigNumberType::INF;
+    }
+
+    bool is_nan( const BigNumberView& number ) {
+        return get_type( number ) == BigNumberType::NOT_A_NUMBER;
+    }
+
+    bool is_special( const BigNumberView& number ) {
+        return get_type( number ) != BigNumberType::DEFAULT;
+    }
+
+    bool has_same_sign( const BigNumberView& lhs, const BigNumberView& rhs ) {
+        return is_negative( lhs ) == is_negative( rhs );
+    }
+
+    const Error& propagate_error( const BigNumberView& lhs,
+                                  const BigNumberView& rhs ) {
+        const Error& err_a = get_error( lhs );
+        const Error& err_b = get_error( rhs );
+        return !is_ok( err_a ) ? err_a : err_b;
+    }
 }
@@ -34,4 +34,33 @@ namespace big_number {
     bool has_same_sign( const BigNumber& lhs, const BigNumber& rhs );
 
     const Error& propagate_error( const BigNumber& lhs, const BigNumber& rhs );
+
+    const Error& get_error( const BigNumberView& number );
+
+    int32_t get_shift( const BigNumberView& number );
+
+    size_t get_size( const BigNumberView& number );
+
+    BigNumberType get_type( const BigNumberView& number );
+
+    std::span<const chunk> get_mantissa( const BigNumberView& number );
+
+    chunk get_shifted_chunk( const BigNumberView& number, int32_t index );
+
+    int32_t count_power( const BigNumberView& number );
+
+    bool is_negative( const BigNumberView& number );
+
+    bool is_zero( const BigNumberView& number );
+
+    bool is_inf( const BigNumberView& number );
+
+    bool is_nan( const BigNumberView& number );
+
+    bool is_special( const BigNumberView& number );
+
+    bool has_same_sign( const BigNumberView& lhs, const BigNumberView& rhs );
+
+    const Error& propagate_error( const BigNumberView& lhs,
+                                  const BigNumberView& rhs );
 }
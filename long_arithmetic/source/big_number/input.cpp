@@ -1,3 +1,10 @@
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "constructors.hpp"
@@ -79,4 +86,242 @@ namespace big_number {
                                 error,
                                 is_negative );
     }
+
+    // Eight ASCII digits are checked and converted as one little-endian
+    // word; elsewhere the parser goes digit by digit.
+    constexpr bool HAS_SWAR_DIGITS =
+        std::endian::native == std::endian::little;
+    constexpr size_t SWAR_DIGITS = 8;
+    constexpr uint64_t SWAR_ZEROS = 0x3030303030303030;
+    constexpr chunk SWAR_DIGITS_POWER = 100000000;
+    constexpr int64_t MAX_PARSED_EXPONENT = 1000000000;
+
+    inline uint64_t load_digits( const char* first ) {
+        uint64_t value;
+        std::memcpy( &value, first, sizeof( value ) );
+        return value;
+    }
+
+    inline bool is_digit( char value ) {
+        return static_cast<unsigned char>( value - ZERO_CHAR ) < 10;
+    }
+
+    inline bool is_eight_digits( uint64_t value ) {
+        return ( ( value & 0xF0F0F0F0F0F0F0F0 ) |
+                 ( ( ( value + 0x0606060606060606 ) & 0xF0F0F0F0F0F0F0F0 ) >>
+                   4 ) ) == 0x3333333333333333;
+    }
+
+    // Pairs, then quads, then the two halves are merged with one multiply
+    // each; the first character is the most significant digit.
+    inline uint32_t parse_eight_digits( uint64_t value ) {
+        constexpr uint64_t mask = 0x000000FF000000FF;
+        constexpr uint64_t low_factors = 100 + ( 1000000ULL << 32 );
+        constexpr uint64_t high_factors = 1 + ( 10000ULL << 32 );
+
+        value -= SWAR_ZEROS;
+        value = value * 10 + ( value >> 8 );
+        value = ( ( value & mask ) * low_factors +
+                  ( ( value >> 16 ) & mask ) * high_factors ) >>
+                32;
+        return static_cast<uint32_t>( value );
+    }
+
+    const char* skip_digits( const char* first, const char* last ) {
+        if constexpr ( HAS_SWAR_DIGITS ) {
+            while ( last - first >= static_cast<ptrdiff_t>( SWAR_DIGITS ) &&
+                    is_eight_digits( load_digits( first ) ) ) {
+                first += SWAR_DIGITS;
+            }
+        }
+        while ( first != last && is_digit( *first ) ) {
+            ++first;
+        }
+        return first;
+    }
+
+    const char* skip_zeros( const char* first, const char* last ) {
+        while ( first != last && *first == ZERO_CHAR ) {
+            ++first;
+        }
+        return first;
+    }
+
+    chunk parse_chunk( const char* first ) {
+        if constexpr ( HAS_SWAR_DIGITS ) {
+            chunk high = parse_eight_digits( load_digits( first ) );
+            chunk low = parse_eight_digits( load_digits( first + 8 ) );
+            return ( high * SWAR_DIGITS_POWER + low ) * 100 +
+                   ( first[16] - ZERO_CHAR ) * 10 + ( first[17] - ZERO_CHAR );
+        }
+
+        chunk value = ZERO_INT;
+        for ( const char* digit = first; digit != first + BASE; ++digit ) {
+            value = value * 10 + ( *digit - ZERO_CHAR );
+        }
+        return value;
+    }
+
+    // Fills chunks from the most significant one down; the first chunk
+    // takes width digits, the others BASE.
+    struct ChunkWriter {
+        chunks& container;
+        size_t index;
+        chunk value;
+        int32_t filled;
+        int32_t width;
+    };
+
+    void emit_chunk( ChunkWriter& writer ) {
+        writer.container[--writer.index] = writer.value;
+        writer.value = ZERO_INT;
+        writer.filled = ZERO_INT;
+        writer.width = BASE;
+    }
+
+    void write_digits( ChunkWriter& writer, std::string_view digits ) {
+        const char* first = digits.data();
+        const char* last = first + digits.size();
+        while ( first != last ) {
+            if ( writer.filled == ZERO_INT && writer.width == BASE &&
+                 last - first >= BASE ) {
+                writer.value = parse_chunk( first );
+                first += BASE;
+                emit_chunk( writer );
+                continue;
+            }
+
+            writer.value = writer.value * 10 + ( *first++ - ZERO_CHAR );
+            if ( ++writer.filled == writer.width ) emit_chunk( writer );
+        }
+    }
+
+    // Significant digits are split by the decimal point into two ranges.
+    struct DecimalText {
+        std::string_view integer;
+        std::string_view fraction;
+        int64_t exponent;
+        bool is_negative;
+    };
+
+    BigNumber make_big_number( const DecimalText& text, const Error& error ) {
+        size_t size = text.integer.size() + text.fraction.size();
+        if ( size == ZERO_INT ) return make_zero( error, text.is_negative );
+
+        if ( size > MAX_DIGITS )
+            return make_from_overflowed_digits(
+                ZERO_INT, text.is_negative, error );
+
+        if ( std::abs( text.exponent ) > MAX_EXP )
+            return make_from_overflowed_exp(
+                text.exponent < ZERO_INT ? -ONE_INT : ONE_INT,
+                text.is_negative,
+                error );
+
+        int32_t exponent = static_cast<int32_t>( text.exponent );
+        digit offset = compute_offset( exponent );
+        size_t count = ( size + offset + BASE - ONE_INT ) / BASE;
+
+        chunks container( count );
+        int32_t width =
+            static_cast<int32_t>( size + offset - ( count - ONE_INT ) * BASE );
+        ChunkWriter writer{ container, count, ZERO_INT, ZERO_INT, width };
+        write_digits( writer, text.integer );
+        write_digits( writer, text.fraction );
+        if ( writer.index != ZERO_INT ) {
+            for ( ; writer.filled < writer.width; ++writer.filled ) {
+                writer.value *= 10;
+            }
+            emit_chunk( writer );
+        }
+
+        return make_big_number( std::move( container ),
+                                compute_shift( exponent, offset ),
+                                BigNumberType::DEFAULT,
+                                error,
+                                text.is_negative );
+    }
+
+    // Reads [eE][+-]digits, saturating the value; returns first if there
+    // is no exponent.
+    const char*
+    parse_exponent( const char* first, const char* last, int64_t& exponent ) {
+        const char* current = first;
+        if ( current == last || ( *current != 'e' && *current != 'E' ) )
+            return first;
+
+        bool is_negative = ++current != last && *current == '-';
+        if ( current != last && ( *current == '-' || *current == '+' ) )
+            ++current;
+        if ( current == last || !is_digit( *current ) ) return first;
+
+        int64_t value = ZERO_INT;
+        for ( ; current != last && is_digit( *current ); ++current ) {
+            value = std::min( value * 10 + ( *current - ZERO_CHAR ),
+                              MAX_PARSED_EXPONENT );
+        }
+        exponent = is_negative ? -value : value;
+        return current;
+    }
+
+    bool
+    starts_with( const char* first, const char* last, std::string_view word ) {
+        return static_cast<size_t>( last - first ) >= word.size() &&
+               std::string_view( first, word.size() ) == word;
+    }
+
+    std::from_chars_result
+    from_chars( const char* first, const char* last, BigNumber& number ) {
+        const Error error = get_default_error();
+        const char* current = first;
+        bool is_negative = current != last && *current == '-';
+        if ( current != last && ( *current == '-' || *current == '+' ) )
+            ++current;
+
+        if ( starts_with( current, last, NAN_STR ) ) {
+            number = make_nan( error, is_negative );
+            return { current + NAN_STR.size(), std::errc{} };
+        }
+        if ( starts_with( current, last, INF_STR ) ) {
+            number = make_inf( error, is_negative );
+            return { current + INF_STR.size(), std::errc{} };
+        }
+
+        const char* integer_end = skip_digits( current, last );
+        const char* fraction_first = integer_end;
+        const char* fraction_end = integer_end;
+        if ( integer_end != last && *integer_end == DOT_STR[0] ) {
+            fraction_first = integer_end + ONE_INT;
+            fraction_end = skip_digits( fraction_first, last );
+        }
+        if ( integer_end == current && fraction_end == fraction_first )
+            return { first, std::errc::invalid_argument };
+
+        // Leading zeros are not significant, even past the point.
+        const char* integer_first = skip_zeros( current, integer_end );
+        const char* significant_first = fraction_first;
+        if ( integer_first == integer_end )
+            significant_first = skip_zeros( fraction_first, fraction_end );
+
+        DecimalText text{
+            std::string_view( integer_first, integer_end - integer_first ),
+            std::string_view( significant_first,
+                              fraction_end - significant_first ),
+            ZERO_INT,
+            is_negative };
+        const char* end = parse_exponent( fraction_end, last, text.exponent );
+        text.exponent -= fraction_end - fraction_first;
+
+        number = make_big_number( text, error );
+        return { end, std::errc{} };
+    }
+
+    BigNumber parse( std::string_view text ) {
+        BigNumber number;
+        auto [end, code] =
+            from_chars( text.data(), text.data() + text.size(), number );
+        if ( code != std::errc{} || end != text.data() + text.size() )
+            return make_nan( make_error( ErrorCode::ERROR ) );
+        return number;
+    }
 }
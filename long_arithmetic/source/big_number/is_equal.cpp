@@ -1,35 +1,37 @@
+#include <algorithm>
+
 #include "big_number.hpp"
 #include "getters.hpp"
 
 namespace big_number {
-    bool has_equal_mantissa( const BigNumber& lhs, const BigNumber& rhs ) {
-        const chunks& lhs_mantissa = get_mantissa( lhs );
-        const chunks& rhs_mantissa = get_mantissa( rhs );
-
-        return ( lhs_mantissa.size() != rhs_mantissa.size() )
-                   ? false
-                   : lhs_mantissa == rhs_mantissa;
+    bool has_equal_mantissa( const BigNumberView& lhs,
+                             const BigNumberView& rhs ) {
+        return std::ranges::equal( get_mantissa( lhs ), get_mantissa( rhs ) );
     }
 
-    bool has_equal_shift( const BigNumber& lhs, const BigNumber& rhs ) {
+    bool has_equal_shift( const BigNumberView& lhs, const BigNumberView& rhs ) {
         return get_shift( lhs ) == get_shift( rhs );
     }
 
-    bool has_equal_sign( const BigNumber& lhs, const BigNumber& rhs ) {
+    bool has_equal_sign( const BigNumberView& lhs, const BigNumberView& rhs ) {
         return is_negative( lhs ) == is_negative( rhs );
     }
 
-    bool has_equal_type( const BigNumber& lhs, const BigNumber& rhs ) {
+    bool has_equal_type( const BigNumberView& lhs, const BigNumberView& rhs ) {
         return get_type( lhs ) == get_type( rhs );
     }
 
-    bool is_any_nan( const BigNumber& left, const BigNumber& right ) {
+    bool is_any_nan( const BigNumberView& left, const BigNumberView& right ) {
         return is_nan( left ) || is_nan( right );
     }
 
-    bool is_equal( const BigNumber& lhs, const BigNumber& rhs ) {
+    bool is_equal( const BigNumberView& lhs, const BigNumberView& rhs ) {
         if ( is_any_nan( lhs, rhs ) ) return false;
         return has_equal_type( lhs, rhs ) && has_equal_sign( lhs, rhs ) &&
                has_equal_shift( lhs, rhs ) && has_equal_mantissa( lhs, rhs );
     }
+
+    bool is_equal( const BigNumber& lhs, const BigNumber& rhs ) {
+        return is_equal( make_view( lhs ), make_view( rhs ) );
+    }
 }
@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include "constants.hpp"
+#include "mul.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    void unbalanced_mul_into( chunks_view lhs,
+                              chunks_view rhs,
+                              chunks_span product ) {
+        if ( lhs.size() < rhs.size() ) std::swap( lhs, rhs );
+
+        std::ranges::fill( product, ZERO_INT );
+        chunks block( lhs.size() + rhs.size() );
+
+        for ( size_t offset = 0; offset < lhs.size(); offset += rhs.size() ) {
+            chunks_view piece = lhs.subspan(
+                offset, std::min( rhs.size(), lhs.size() - offset ) );
+            chunks_span block_product =
+                chunks_span( block ).first( piece.size() + rhs.size() );
+
+            multiply_into( piece, rhs, block_product );
+            add_chunks_into( product.subspan( offset ),
+                             trim_chunks( block_product ) );
+        }
+    }
+
+    void karatsuba_mul_into( chunks_view lhs,
+                             chunks_view rhs,
+                             chunks_span product ) {
+        if ( lhs.size() < rhs.size() ) std::swap( lhs, rhs );
+
+        size_t half = ( lhs.size() + ONE_INT ) / 2;
+        if ( rhs.size() <= half )
+            return unbalanced_mul_into( lhs, rhs, product );
+
+        chunks_view lhs_low = lhs.first( half );
+        chunks_view lhs_high = lhs.subspan( half );
+        chunks_view rhs_low = rhs.first( half );
+        chunks_view rhs_high = rhs.subspan( half );
+
+        chunks_span low_product = product.first( 2 * half );
+        chunks_span high_product = product.subspan( 2 * half );
+
+        multiply_into( lhs_low, rhs_low, low_product );
+        multiply_into( lhs_high, rhs_high, high_product );
+
+        chunks lhs_sum = add_chunks( lhs_low, lhs_high );
+        chunks rhs_sum = add_chunks( rhs_low, rhs_high );
+        chunks middle( lhs_sum.size() + rhs_sum.size() );
+
+        multiply_into( lhs_sum, rhs_sum, middle );
+        sub_chunks_into( middle, low_product );
+        sub_chunks_into( middle, high_product );
+
+        add_chunks_into( product.subspan( half ), trim_chunks( middle ) );
+    }
+
+    void karatsuba_sqr_into( chunks_view value, chunks_span product ) {
+        size_t half = ( value.size() + ONE_INT ) / 2;
+        chunks_view low = value.first( half );
+        chunks_view high = value.subspan( half );
+
+        chunks_span low_product = product.first( 2 * half );
+        chunks_span high_product = product.subspan( 2 * half );
+
+        square_into( low, low_product );
+        square_into( high, high_product );
+
+        chunks sum = add_chunks( low, high );
+        chunks middle( 2 * sum.size() );
+
+        square_into( sum, middle );
+        sub_chunks_into( middle, low_product );
+        sub_chunks_into( middle, high_product );
+
+        add_chunks_into( product.subspan( half ), trim_chunks( middle ) );
+    }
+}
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "constructors.hpp"
+#include "div.hpp"
+#include "natural.hpp"
+#include "series.hpp"
+#include "sqrt.hpp"
+#include "worker_pool.hpp"
+
+namespace big_number {
+    // Each constant is computed this many chunks past the last kept one, so
+    // the rounding of the final quotients stays out of the result.
+    constexpr size_t GUARD_CHUNKS = 2;
+
+    // Chudnovsky: 1 / pi = 12 / 640320^( 3 / 2 ) times the sum of
+    // ( -1 )^k ( 6k )! ( A + B k ) / ( ( 3k )! k!^3 640320^( 3k ) ). The
+    // terms shrink by log10( 640320^3 / 1728 ) = 14.1816... digits each.
+    constexpr mul_chunk CHUDNOVSKY_A = 13591409;
+    constexpr mul_chunk CHUDNOVSKY_B = 545140134;
+    constexpr mul_chunk CHUDNOVSKY_Q = 10939058860032000;
+    constexpr chunk CHUDNOVSKY_FACTOR = 426880;
+    constexpr chunk CHUDNOVSKY_RADICAND = 10005;
+    constexpr double CHUDNOVSKY_DIGITS_PER_TERM = 14.18;
+
+    // ln( 2 ) = 18 arccoth( 26 ) - 2 arccoth( 4801 ) + 8 arccoth( 8749 ),
+    // with arccoth( x ) the sum of 1 / ( ( 2k + 1 ) x^( 2k + 1 ) ).
+    struct ArccothTerm {
+        chunk x;
+        chunk factor;
+        bool is_negative;
+    };
+
+    constexpr ArccothTerm LN2_TERMS[] = { { 26, 18, false },
+                                          { 4801, 2, true },
+                                          { 8749, 8, false } };
+
+    size_t count_digits( size_t fraction ) {
+        return BASE * ( fraction + GUARD_CHUNKS );
+    }
+
+    chunks shift_up( chunks_view value, size_t count ) {
+        chunks result( count, ZERO_INT );
+        result.insert( result.end(), value.begin(), value.end() );
+        return result;
+    }
+
+    SeriesTerm chudnovsky_term( uint64_t index ) {
+        if ( index == ZERO_INT )
+            return { ONE_INT, ONE_INT, CHUDNOVSKY_A, ONE_INT, false };
+
+        mul_chunk k = index;
+        return { ( 6 * k - 5 ) * ( 2 * k - 1 ) * ( 6 * k - 1 ),
+                 k * k * k * CHUDNOVSKY_Q,
+                 CHUDNOVSKY_A + CHUDNOVSKY_B * k,
+                 ONE_INT,
+                 true };
+    }
+
+    SeriesTerm exp_term( uint64_t index ) {
+        if ( index == ZERO_INT )
+            return { ONE_INT, ONE_INT, ONE_INT, ONE_INT, false };
+        return { ONE_INT, index, ONE_INT, ONE_INT, false };
+    }
+
+    // pi = 426880 sqrt( 10005 ) q / t.
+    chunks compute_pi( size_t fraction ) {
+        uint64_t count = static_cast<uint64_t>( count_digits( fraction ) /
+                                                CHUDNOVSKY_DIGITS_PER_TERM ) +
+                         2;
+        SeriesSplit split = split_series( chudnovsky_term, count, false );
+
+        size_t scale = fraction + GUARD_CHUNKS;
+        chunks radicand( 2 * scale, ZERO_INT );
+        radicand.push_back( CHUDNOVSKY_RADICAND );
+        chunks numerator = mul_chunks_small(
+            multiply_chunks( sqrt_chunks( radicand ), split.q ),
+            CHUDNOVSKY_FACTOR );
+
+        return divide_chunks( numerator, shift_up( split.t, GUARD_CHUNKS ) )
+            .quotient;
+    }
+
+    // e is the sum of 1 / k!, and log10( count! ) has to pass the digits.
+    chunks compute_e( size_t fraction ) {
+        double digits = static_cast<double>( count_digits( fraction ) );
+        uint64_t count = 1;
+        for ( double sum = 0; sum <= digits; ++count ) {
+            sum += std::log10( static_cast<double>( count ) );
+        }
+
+        SeriesSplit split = split_series( exp_term, count, false );
+        return divide_chunks( shift_up( split.t, fraction ), split.q )
+            .quotient;
+    }
+
+    // floor( arccoth( x ) * MAX_CHUNK^scale ); the terms shrink by x^2.
+    chunks compute_arccoth( chunk x, size_t scale ) {
+        double digits = static_cast<double>( BASE * scale );
+        double digits_per_term = 2 * std::log10( static_cast<double>( x ) );
+        uint64_t count = static_cast<uint64_t>( digits / digits_per_term ) + 2;
+        mul_chunk ratio = static_cast<mul_chunk>( x ) * x;
+        auto term = [ratio]( uint64_t index ) -> SeriesTerm {
+            if ( index == ZERO_INT )
+                return { ONE_INT, ONE_INT, ONE_INT, ONE_INT, false };
+            return { ONE_INT, ratio, ONE_INT, 2 * index + ONE_INT, false };
+        };
+
+        SeriesSplit split = split_series( term, count, true );
+        chunks denominator =
+            mul_chunks_small( multiply_chunks( split.b, split.q ), x );
+        return divide_chunks( shift_up( split.t, scale ), denominator )
+            .quotient;
+    }
+
+    // The three series are independent, so they run on separate threads.
+    chunks compute_ln2( size_t fraction ) {
+        size_t scale = fraction + GUARD_CHUNKS;
+        chunks parts[std::size( LN2_TERMS )];
+        std::shared_ptr<WorkerPool> pool = get_mul_pool();
+        run_parallel( pool.get(), std::size( LN2_TERMS ), [&]( size_t i ) {
+            parts[i] = mul_chunks_small(
+                compute_arccoth( LN2_TERMS[i].x, scale ),
+                LN2_TERMS[i].factor );
+        } );
+
+        chunks sum;
+        for ( size_t i = 0; i < std::size( LN2_TERMS ); ++i ) {
+            if ( !LN2_TERMS[i].is_negative ) sum = add_chunks( sum, parts[i] );
+        }
+        for ( size_t i = 0; i < std::size( LN2_TERMS ); ++i ) {
+            if ( LN2_TERMS[i].is_negative ) sum = sub_chunks( sum, parts[i] );
+        }
+
+        sum.erase( sum.begin(), sum.begin() + GUARD_CHUNKS );
+        return sum;
+    }
+
+    // floor( value * MAX_CHUNK^fraction ) by precision in chunks. A
+    // precision is cut from any longer one already computed.
+    struct ConstantCache {
+        std::mutex mutex;
+        std::map<size_t, chunks> values;
+    };
+
+    static ConstantCache pi_cache;
+    static ConstantCache e_cache;
+    static ConstantCache ln2_cache;
+
+    BigNumber get_constant( ConstantCache& cache,
+                            size_t precision,
+                            size_t integer_chunks,
+                            chunks ( *compute )( size_t fraction ) ) {
+        size_t digits = std::clamp( precision, size_t( 1 ), PRECISION );
+        size_t size = ( digits + BASE - ONE_INT ) / BASE;
+        size_t fraction = size - integer_chunks;
+
+        chunks mantissa;
+        {
+            std::lock_guard lock( cache.mutex );
+            auto found = cache.values.lower_bound( size );
+            if ( found == cache.values.end() ) {
+                // The cache outlives any resource of the caller.
+                MantissaResourceScope heap( nullptr );
+                found = cache.values.emplace( size, compute( fraction ) ).first;
+            }
+
+            const chunks& value = found->second;
+            mantissa.assign( value.end() - size, value.end() );
+        }
+
+        return make_big_number( std::move( mantissa ),
+                                -static_cast<int32_t>( fraction ),
+                                BigNumberType::DEFAULT,
+                                get_default_error(),
+                                false );
+    }
+
+    BigNumber pi( size_t precision ) {
+        return get_constant( pi_cache, precision, ONE_INT, compute_pi );
+    }
+
+    BigNumber e( size_t precision ) {
+        return get_constant( e_cache, precision, ONE_INT, compute_e );
+    }
+
+    BigNumber ln2( size_t precision ) {
+        return get_constant( ln2_cache, precision, ZERO_INT, compute_ln2 );
+    }
+
+    void clear_constants_cache() {
+        for ( ConstantCache* cache : { &pi_cache, &e_cache, &ln2_cache } ) {
+            std::lock_guard lock( cache->mutex );
+            cache->values.clear();
+        }
+    }
+}
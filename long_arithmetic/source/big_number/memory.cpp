@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+
+namespace big_number {
+    // Mantissas of up to INLINE_CHUNKS chunks never allocate. Longer ones
+    // allocate from the resource current on the thread that constructs them,
+    // so results computed inside a scope come from the caller's resource.
+    // The values have to die before the resource does, and an unsynchronized
+    // resource must only be used from its own thread. Work the mul pool
+    // runs on other threads allocates from their heap.
+    std::pmr::memory_resource* get_mantissa_resource() {
+        return chunks::get_thread_resource();
+    }
+
+    std::pmr::memory_resource*
+    set_mantissa_resource( std::pmr::memory_resource* resource ) {
+        return chunks::set_thread_resource( resource );
+    }
+
+    MantissaResourceScope::MantissaResourceScope(
+        std::pmr::memory_resource* resource )
+        : previous( set_mantissa_resource( resource ) ) {}
+
+    MantissaResourceScope::~MantissaResourceScope() {
+        set_mantissa_resource( previous );
+    }
+
+    // Hands out memory by bumping a pointer and frees it all at once, for
+    // temporaries that die together.
+    std::unique_ptr<std::pmr::memory_resource>
+    make_mantissa_arena( size_t initial_chunks ) {
+        return std::make_unique<std::pmr::monotonic_buffer_resource>(
+            std::max( initial_chunks, MIN_CHUNKS ) * sizeof( chunk ) );
+    }
+
+    // Size classes up to a full product of two MAX_CHUNKS operands, so every
+    // mantissa and scratch buffer is recycled instead of going back to the
+    // heap.
+    constexpr size_t POOL_BLOCKS_PER_CHUNK = 64;
+    constexpr size_t POOL_LARGEST_BLOCK = 2 * MAX_CHUNKS * sizeof( chunk );
+
+    std::unique_ptr<std::pmr::memory_resource> make_mantissa_pool() {
+        return std::make_unique<std::pmr::unsynchronized_pool_resource>(
+            std::pmr::pool_options{ POOL_BLOCKS_PER_CHUNK,
+                                    POOL_LARGEST_BLOCK } );
+    }
+}
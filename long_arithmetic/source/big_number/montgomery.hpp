@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+namespace big_number {
+    // Montgomery arithmetic modulo an odd MOD < 2^31 with R = 2^32, so every
+    // reduction is two multiplications and a shift instead of a division.
+    // mul() returns lhs * rhs * R^-1: multiplying a plain value by an operand
+    // kept in Montgomery form (x * R) yields a plain product.
+    template <uint32_t MOD>
+    struct Montgomery {
+        static_assert( MOD % 2 == 1, "Montgomery modulus must be odd" );
+        static_assert( MOD < ( 1U << 31 ),
+                       "Montgomery modulus exceeds 31 bits" );
+
+        static constexpr uint32_t compute_neg_inverse() {
+            uint32_t inverse = MOD;
+            for ( int i = 0; i < 4; ++i ) {
+                inverse *= 2 - MOD * inverse;
+            }
+            return -inverse;
+        }
+
+        static constexpr uint32_t NEG_INVERSE = compute_neg_inverse();
+        static constexpr uint32_t R2 = static_cast<uint32_t>(
+            ( static_cast<uint64_t>( -1 ) % MOD + 1 ) % MOD );
+
+        static_assert( MOD * -NEG_INVERSE == 1, "Montgomery inverse is wrong" );
+
+        static constexpr uint32_t reduce( uint64_t value ) {
+            uint32_t factor = static_cast<uint32_t>( value ) * NEG_INVERSE;
+            uint32_t result = static_cast<uint32_t>(
+                ( value + static_cast<uint64_t>( factor ) * MOD ) >> 32 );
+            return result >= MOD ? result - MOD : result;
+        }
+
+        static constexpr uint32_t mul( uint32_t lhs, uint32_t rhs ) {
+            return reduce( static_cast<uint64_t>( lhs ) * rhs );
+        }
+
+        static constexpr uint32_t to_montgomery( uint32_t value ) {
+            return mul( value, R2 );
+        }
+
+        static constexpr uint32_t add( uint32_t lhs, uint32_t rhs ) {
+            uint32_t sum = lhs + rhs;
+            return sum >= MOD ? sum - MOD : sum;
+        }
+
+        static constexpr uint32_t sub( uint32_t lhs, uint32_t rhs ) {
+            return lhs >= rhs ? lhs - rhs : lhs + MOD - rhs;
+        }
+    };
+}
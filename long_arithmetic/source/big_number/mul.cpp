@@ -1,201 +1,192 @@
+#include "mul.hpp"
+
+#include <algorithm>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "constructors.hpp"
 #include "getters.hpp"
-
-#define MULTIPLY_THRESHOLD 1000
+#include "natural.hpp"
 
 namespace big_number {
-    constexpr uint32_t MOD1 = 998244353;
-    constexpr uint32_t MOD2 = 1004535809;
-    constexpr uint32_t MOD3 = 469762049;
-    constexpr uint32_t ROOT = 3;
-
-    chunks remove_trailing_zeros( const chunks& value ) {
-        auto last_non_zero =
-            std::ranges::find_if( value.rbegin(), value.rend(), []( chunk c ) {
-                return c != ZERO_INT;
-            } );
-
-        return chunks( value.begin(), last_non_zero.base() );
-    }
+    MulAlgorithm choose_mul_algorithm( size_t lhs_size, size_t rhs_size ) {
+        size_t size = std::min( lhs_size, rhs_size );
 
-    uint32_t mod_pow( uint64_t a, uint64_t e, uint32_t mod ) {
-        uint64_t res = 1, base = a % mod;
-        while ( e ) {
-            if ( e & 1 ) res = ( res * base ) % mod;
-            base = ( base * base ) % mod;
-            e >>= 1;
-        }
-        return static_cast<uint32_t>( res );
+        if ( size < KARATSUBA_THRESHOLD ) return MulAlgorithm::SCHOOLBOOK;
+        if ( size < NTT_THRESHOLD ) return MulAlgorithm::KARATSUBA;
+        return MulAlgorithm::NTT;
     }
 
-    static void ntt_mod( std::vector<uint32_t>& a, bool invert, uint32_t mod ) {
-        size_t n = a.size();
-        for ( size_t i = 1, j = 0; i < n; ++i ) {
-            size_t bit = n >> 1;
-            for ( ; j & bit; bit >>= 1 )
-                j ^= bit;
-            j |= bit;
-            if ( i < j ) std::swap( a[i], a[j] );
-        }
-
-        for ( size_t len = 2; len <= n; len <<= 1 ) {
-            uint32_t wlen = mod_pow( ROOT, ( mod - 1 ) / len, mod );
-            if ( invert ) wlen = mod_pow( wlen, mod - 2, mod );
-
-            for ( size_t i = 0; i < n; i += len ) {
-                uint32_t w = 1;
-                for ( size_t j = 0; j < ( len >> 1 ); ++j ) {
-                    uint32_t u = a[i + j];
-                    uint32_t v =
-                        static_cast<uint64_t>( a[i + j + ( len >> 1 )] ) * w %
-                        mod;
-
-                    a[i + j] = u + v < mod ? u + v : u + v - mod;
-                    a[i + j + ( len >> 1 )] = u >= v ? u - v : u + mod - v;
-                    w = static_cast<uint64_t>( w ) * wlen % mod;
-                }
-            }
-        }
-
-        if ( invert ) {
-            uint32_t inv_n = mod_pow( n, mod - 2, mod );
-            for ( size_t i = 0; i < a.size(); ++i ) {
-                a[i] = static_cast<uint64_t>( a[i] ) * inv_n % mod;
-            }
-        }
+    MulAlgorithm choose_sqr_algorithm( size_t size ) {
+        if ( size < KARATSUBA_SQR_THRESHOLD ) return MulAlgorithm::SCHOOLBOOK;
+        if ( size < NTT_SQR_THRESHOLD ) return MulAlgorithm::KARATSUBA;
+        return MulAlgorithm::NTT;
     }
 
-    std::vector<uint32_t> to_base1e9( const chunks& c ) {
-        std::vector<uint32_t> d;
-        d.reserve( c.size() * 2 );
-        for ( size_t i = 0; i < c.size(); ++i ) {
-            d.push_back( c[i] % 1000000000ULL );
-            d.push_back( c[i] / 1000000000ULL );
-        }
-        return d;
+    bool is_same_operand( chunks_view lhs, chunks_view rhs ) {
+        if ( lhs.size() != rhs.size() ) return false;
+        return lhs.data() == rhs.data() || std::ranges::equal( lhs, rhs );
     }
 
-    chunks from_ntt_crt3( const std::vector<uint32_t>& r1,
-                          const std::vector<uint32_t>& r2,
-                          const std::vector<uint32_t>& r3 ) {
-        size_t n = r1.size();
-        const __int128 m1 = MOD1, m2 = MOD2, m3 = MOD3;
-        const __int128 m12 = m1 * m2;
-
-        uint64_t inv_m1_mod2 =
-            mod_pow( static_cast<uint64_t>( m1 % m2 ), m2 - 2, MOD2 );
-        uint64_t inv_m12_mod3 =
-            mod_pow( static_cast<uint64_t>( m12 % m3 ), m3 - 2, MOD3 );
-
-        std::vector<__int128> coeff( n );
-        for ( size_t i = 0; i < n; ++i ) {
-            __int128 t = ( static_cast<__int128>( r2[i] ) - r1[i] + m2 ) % m2;
-            t = t * inv_m1_mod2 % m2;
-            __int128 x12 = r1[i] + t * m1;
-
-            t = ( static_cast<__int128>( r3[i] ) - ( x12 % m3 ) + m3 ) % m3;
-            t = t * inv_m12_mod3 % m3;
-            coeff[i] = x12 + t * m12;
+    void multiply_into( chunks_view lhs,
+                        chunks_view rhs,
+                        chunks_span product,
+                        MulAlgorithm algorithm ) {
+        if ( lhs.empty() || rhs.empty() ) {
+            std::ranges::fill( product, ZERO_INT );
+            return;
         }
 
-        std::vector<uint32_t> digits;
-        digits.reserve( n + 1 );
-        __int128 carry = 0;
-        for ( size_t i = 0; i < n; ++i ) {
-            __int128 val = coeff[i] + carry;
-            digits.push_back( static_cast<uint32_t>( val % 1000000000 ) );
-            carry = val / 1000000000;
+        if ( is_same_operand( lhs, rhs ) )
+            return square_into( lhs, product, algorithm );
+
+        if ( algorithm == MulAlgorithm::AUTO )
+            algorithm = choose_mul_algorithm( lhs.size(), rhs.size() );
+
+        switch ( algorithm ) {
+        case MulAlgorithm::AUTO:
+        case MulAlgorithm::SCHOOLBOOK:
+            return simple_mul_into( lhs, rhs, product );
+        case MulAlgorithm::KARATSUBA:
+            return karatsuba_mul_into( lhs, rhs, product );
+        case MulAlgorithm::TOOM3:
+            return toom3_mul_into( lhs, rhs, product );
+        case MulAlgorithm::NTT:
+            return ntt_mul_into( lhs, rhs, product );
         }
+    }
 
-        while ( carry > 0 ) {
-            digits.push_back( static_cast<uint32_t>( carry % 1000000000 ) );
-            carry /= 1000000000;
+    void square_into( chunks_view value,
+                      chunks_span product,
+                      MulAlgorithm algorithm ) {
+        if ( value.empty() ) {
+            std::ranges::fill( product, ZERO_INT );
+            return;
         }
 
-        chunks out;
-        out.reserve( digits.size() / 2 );
-        for ( size_t i = 0; i < digits.size(); i += 2 ) {
-            uint64_t low = digits[i];
-            uint64_t high = ( i + 1 < digits.size() ) ? digits[i + 1] : 0;
-            out.push_back( static_cast<chunk>( high ) * 1000000000ULL + low );
+        if ( algorithm == MulAlgorithm::AUTO )
+            algorithm = choose_sqr_algorithm( value.size() );
+
+        switch ( algorithm ) {
+        case MulAlgorithm::AUTO:
+        case MulAlgorithm::SCHOOLBOOK:
+            return simple_sqr_into( value, product );
+        case MulAlgorithm::KARATSUBA:
+            return karatsuba_sqr_into( value, product );
+        case MulAlgorithm::TOOM3:
+            return toom3_sqr_into( value, product );
+        case MulAlgorithm::NTT:
+            return ntt_sqr_into( value, product );
         }
-
-        while ( !out.empty() && out.back() == 0 )
-            out.pop_back();
-        return out;
     }
 
-    BigNumber ntt_mul( const BigNumber& A, const BigNumber& B ) {
-        const Error error = propagate_error( A, B );
+    // Splits the three-word column accumulator (high:low) into the chunk
+    // stored at the current position and the carry into the next column.
+    chunk split_column( mul_chunk& low, chunk& high ) {
+        mul_chunk upper =
+            ( static_cast<mul_chunk>( high % MAX_CHUNK ) << 64 ) |
+            static_cast<chunk>( low >> 64 );
+        mul_chunk lower =
+            ( ( upper % MAX_CHUNK ) << 64 ) | static_cast<chunk>( low );
+
+        high /= MAX_CHUNK;
+        low = ( ( upper / MAX_CHUNK ) << 64 ) + lower / MAX_CHUNK;
+        return static_cast<chunk>( lower % MAX_CHUNK );
+    }
 
-        if ( is_zero( A ) || is_zero( B ) ) return make_zero( error );
+    // Product scanning: every column is summed in a 192-bit accumulator, so
+    // only one carry split per output chunk is needed instead of one per
+    // partial product.
+    void
+    simple_mul_into( chunks_view lhs, chunks_view rhs, chunks_span product ) {
+        size_t lhs_size = lhs.size();
+        size_t rhs_size = rhs.size();
+        mul_chunk low = 0;
+        chunk high = 0;
+
+        for ( size_t k = 0; k + ONE_INT < lhs_size + rhs_size; ++k ) {
+            size_t from = k >= rhs_size ? k - rhs_size + ONE_INT : ZERO_INT;
+            size_t to = std::min( k, lhs_size - ONE_INT );
+
+            for ( size_t i = from; i <= to; ++i ) {
+                mul_chunk partial =
+                    static_cast<mul_chunk>( lhs[i] ) * rhs[k - i];
+                low += partial;
+                high += low < partial;
+            }
 
-        std::vector<uint32_t> a = to_base1e9( get_mantissa( A ) );
-        std::vector<uint32_t> b = to_base1e9( get_mantissa( B ) );
+            product[k] = split_column( low, high );
+        }
 
-        size_t n = 1;
-        while ( n < a.size() + b.size() )
-            n <<= 1;
+        product[lhs_size + rhs_size - ONE_INT] = static_cast<chunk>( low );
+    }
 
-        a.resize( n, 0 );
-        b.resize( n, 0 );
+    // Every cross product a[i] * a[k - i] appears twice in column k, so only
+    // the lower half is summed and doubled before the square term is added.
+    void simple_sqr_into( chunks_view value, chunks_span product ) {
+        size_t size = value.size();
+        mul_chunk low = 0;
+        chunk high = 0;
+
+        for ( size_t k = 0; k + ONE_INT < 2 * size; ++k ) {
+            size_t from = k >= size ? k - size + ONE_INT : ZERO_INT;
+            mul_chunk column_low = 0;
+            chunk column_high = 0;
+
+            for ( size_t i = from; 2 * i < k; ++i ) {
+                mul_chunk partial =
+                    static_cast<mul_chunk>( value[i] ) * value[k - i];
+                column_low += partial;
+                column_high += column_low < partial;
+            }
 
-        std::vector<uint32_t> a1( a );
-        std::vector<uint32_t> b1( b );
-        std::vector<uint32_t> a2( a );
-        std::vector<uint32_t> b2( b );
-        std::vector<uint32_t> a3( a );
-        std::vector<uint32_t> b3( b );
+            column_high = ( column_high << 1 ) | ( column_low >> 127 );
+            column_low <<= 1;
 
-        ntt_mod( a1, false, MOD1 );
-        ntt_mod( b1, false, MOD1 );
-        ntt_mod( a2, false, MOD2 );
-        ntt_mod( b2, false, MOD2 );
-        ntt_mod( a3, false, MOD3 );
-        ntt_mod( b3, false, MOD3 );
+            if ( k % 2 == ZERO_INT ) {
+                mul_chunk square =
+                    static_cast<mul_chunk>( value[k / 2] ) * value[k / 2];
+                column_low += square;
+                column_high += column_low < square;
+            }
 
-        for ( size_t i = 0; i < n; ++i ) {
-            a1[i] = static_cast<uint64_t>( a1[i] ) * b1[i] % MOD1;
-            a2[i] = static_cast<uint64_t>( a2[i] ) * b2[i] % MOD2;
-            a3[i] = static_cast<uint64_t>( a3[i] ) * b3[i] % MOD3;
+            low += column_low;
+            high += column_high + ( low < column_low );
+            product[k] = split_column( low, high );
         }
 
-        ntt_mod( a1, true, MOD1 );
-        ntt_mod( a2, true, MOD2 );
-        ntt_mod( a3, true, MOD3 );
-
-        int32_t exp = get_shift( A ) + get_shift( B );
-        bool sign = !has_same_sign( A, B );
-
-        return make_big_number(
-            std::move( remove_trailing_zeros( from_ntt_crt3( a1, a2, a3 ) ) ),
-            exp,
-            BigNumberType::DEFAULT,
-            error,
-            sign );
+        product[2 * size - ONE_INT] = static_cast<chunk>( low );
     }
 
-    BigNumber simple_mul( const BigNumber& multiplicand,
-                          const BigNumber& multiplier ) {
+    // With prepared transforms of the multiplicand, NTT-sized products skip
+    // its forward transforms.
+    BigNumber multiply( const BigNumberView& multiplicand,
+                        const BigNumberView& multiplier,
+                        MulAlgorithm algorithm,
+                        PreparedTransforms* prepared = nullptr ) {
         const Error error = propagate_error( multiplicand, multiplier );
-
-        chunks chunks( get_size( multiplicand ) + get_size( multiplier ), 0 );
-        chunk carry = 0;
-        for ( int32_t i = 0; i < get_size( multiplicand ); ++i ) {
-            carry = 0;
-            for ( int32_t j = 0; j < get_size( multiplier ); ++j ) {
-                mul_chunk l_chunk = (mul_chunk)get_chunk( multiplicand, i );
-                mul_chunk r_chunk = (mul_chunk)get_chunk( multiplier, j );
-                mul_chunk product = l_chunk * r_chunk + chunks[i + j] + carry;
-                carry = product / MAX_CHUNK;
-                chunks[i + j] = product % MAX_CHUNK;
-            }
-            chunks[i + get_size( multiplier )] = carry;
+        size_t multiplicand_size = get_size( multiplicand );
+        size_t multiplier_size = get_size( multiplier );
+        bool is_prepared_ntt =
+            prepared != nullptr &&
+            choose_mul_algorithm( multiplicand_size, multiplier_size ) ==
+                MulAlgorithm::NTT;
+
+        chunks product( multiplicand_size + multiplier_size );
+        if ( is_prepared_ntt ) {
+            ntt_mul_prepared_into( *prepared,
+                                   get_mantissa( multiplicand ),
+                                   get_mantissa( multiplier ),
+                                   product );
+        } else {
+            multiply_into( get_mantissa( multiplicand ),
+                           get_mantissa( multiplier ),
+                           product,
+                           algorithm );
         }
 
-        return make_big_number( std::move( remove_trailing_zeros( chunks ) ),
+        product.resize( trim_chunks( product ).size() );
+        return make_big_number( std::move( product ),
                                 get_shift( multiplicand ) +
                                     get_shift( multiplier ),
                                 BigNumberType::DEFAULT,
@@ -204,7 +195,9 @@ namespace big_number {
     }
 
     BigNumber
-    mul_zero( const BigNumber& lhs, const BigNumber& rhs, const Error& error ) {
+    mul_zero( const BigNumberView& lhs,
+              const BigNumberView& rhs,
+              const Error& error ) {
         switch ( get_type( rhs ) ) {
         case BigNumberType::DEFAULT:
             return make_zero( error );
@@ -218,7 +211,9 @@ namespace big_number {
     }
 
     BigNumber
-    mul_inf( const BigNumber& lhs, const BigNumber& rhs, const Error& error ) {
+    mul_inf( const BigNumberView& lhs,
+             const BigNumberView& rhs,
+             const Error& error ) {
         switch ( get_type( rhs ) ) {
         case BigNumberType::DEFAULT:
             return make_inf( error, !has_same_sign( lhs, rhs ) );
@@ -231,7 +226,8 @@ namespace big_number {
         }
     }
 
-    BigNumber mul_special( const BigNumber& lhs, const BigNumber& rhs ) {
+    BigNumber mul_special( const BigNumberView& lhs,
+                           const BigNumberView& rhs ) {
         if ( !is_special( lhs ) && is_special( rhs ) )
             return mul_special( rhs, lhs );
 
@@ -245,18 +241,56 @@ namespace big_number {
         case BigNumberType::ZERO:
             return mul_zero( lhs, rhs, error );
         case BigNumberType::DEFAULT:
-            return ntt_mul( lhs, rhs );
+            return multiply( lhs, rhs, MulAlgorithm::AUTO );
         }
     }
 
-    BigNumber mul( const BigNumber& lhs, const BigNumber& rhs ) {
+    BigNumber mul( const BigNumberView& lhs,
+                   const BigNumberView& rhs,
+                   MulAlgorithm algorithm ) {
         if ( is_special( lhs ) || is_special( rhs ) )
             return mul_special( lhs, rhs );
 
-        if ( static_cast<int>( get_size( lhs ) ) <= MULTIPLY_THRESHOLD ||
-             static_cast<int>( get_size( rhs ) ) <= MULTIPLY_THRESHOLD ) {
-            return simple_mul( lhs, rhs );
-        }
-        return ntt_mul( lhs, rhs );
+        return multiply( lhs, rhs, algorithm );
+    }
+
+    BigNumber
+    mul( const BigNumber& lhs, const BigNumber& rhs, MulAlgorithm algorithm ) {
+        return mul( make_view( lhs ), make_view( rhs ), algorithm );
+    }
+
+    BigNumber mul( const BigNumberView& lhs, const BigNumberView& rhs ) {
+        return mul( lhs, rhs, MulAlgorithm::AUTO );
+    }
+
+    BigNumber mul( const BigNumber& lhs, const BigNumber& rhs ) {
+        return mul( lhs, rhs, MulAlgorithm::AUTO );
+    }
+
+    // The product kernels recognise a shared mantissa and take the squaring
+    // path, so sqr() only has to pass the number twice.
+    BigNumber sqr( const BigNumber& number, MulAlgorithm algorithm ) {
+        return mul( number, number, algorithm );
+    }
+
+    BigNumber sqr( const BigNumber& number ) {
+        return sqr( number, MulAlgorithm::AUTO );
+    }
+
+    PreparedOperand prepare_mul( const BigNumber& number ) {
+        if ( is_special( number ) ) return { number, nullptr };
+        return { number, std::make_shared<PreparedTransforms>() };
+    }
+
+    BigNumber mul( const PreparedOperand& multiplicand,
+                   const BigNumber& multiplier ) {
+        const BigNumber& number = multiplicand.number;
+        if ( multiplicand.transforms == nullptr || is_special( multiplier ) )
+            return mul( number, multiplier );
+
+        return multiply( make_view( number ),
+                         make_view( multiplier ),
+                         MulAlgorithm::AUTO,
+                         multiplicand.transforms.get() );
     }
 }
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "big_number.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    // Smallest operand sizes (in chunks) at which each tier starts to beat
+    // the previous one, see the MulTier benchmarks. Toom-3 is never picked
+    // automatically: past Karatsuba it only ties the NTT at one length and
+    // loses at all others.
+    constexpr size_t KARATSUBA_THRESHOLD = 160;
+    constexpr size_t NTT_THRESHOLD = 250;
+
+    // Squaring halves the schoolbook work and saves a third of the
+    // transforms, which moves the crossovers, see the SqrTier benchmarks.
+    // Toom-3 squaring never wins below the NTT threshold.
+    constexpr size_t KARATSUBA_SQR_THRESHOLD = 240;
+    constexpr size_t NTT_SQR_THRESHOLD = 350;
+
+    MulAlgorithm choose_mul_algorithm( size_t lhs_size, size_t rhs_size );
+
+    MulAlgorithm choose_sqr_algorithm( size_t size );
+
+    void multiply_into( chunks_view lhs,
+                        chunks_view rhs,
+                        chunks_span product,
+                        MulAlgorithm algorithm = MulAlgorithm::AUTO );
+
+    // Same contract as multiply_into() for value * value; product holds
+    // 2 * value.size() chunks.
+    void square_into( chunks_view value,
+                      chunks_span product,
+                      MulAlgorithm algorithm = MulAlgorithm::AUTO );
+
+    void
+    simple_mul_into( chunks_view lhs, chunks_view rhs, chunks_span product );
+
+    void unbalanced_mul_into( chunks_view lhs,
+                              chunks_view rhs,
+                              chunks_span product );
+
+    void karatsuba_mul_into( chunks_view lhs,
+                             chunks_view rhs,
+                             chunks_span product );
+
+    void
+    toom3_mul_into( chunks_view lhs, chunks_view rhs, chunks_span product );
+
+    void ntt_mul_into( chunks_view lhs, chunks_view rhs, chunks_span product );
+
+    void simple_sqr_into( chunks_view value, chunks_span product );
+
+    void karatsuba_sqr_into( chunks_view value, chunks_span product );
+
+    void toom3_sqr_into( chunks_view value, chunks_span product );
+
+    void ntt_sqr_into( chunks_view value, chunks_span product );
+
+    // Products split chunks into two coefficients under three moduli, or
+    // keep whole chunks under five.
+    constexpr size_t MAX_NTT_MODULI = 5;
+
+    // Forward transforms of one operand, one residue vector per modulus in
+    // use.
+    using NttTransforms = std::array<std::vector<uint32_t>, MAX_NTT_MODULI>;
+
+    // Transforms of a prepared multiplicand for every padded length and
+    // modulus count it has been used with, built on first use.
+    struct PreparedTransforms {
+        std::mutex mutex;
+        std::map<std::pair<size_t, size_t>,
+                 std::shared_ptr<const NttTransforms>>
+            by_plan;
+    };
+
+    // ntt_mul_into() where lhs is the mantissa prepared in prepared.
+    void ntt_mul_prepared_into( PreparedTransforms& prepared,
+                                chunks_view lhs,
+                                chunks_view rhs,
+                                chunks_span product );
+}
@@ -0,0 +1,168 @@
+#include "natural.hpp"
+
+#include <algorithm>
+
+#include "constants.hpp"
+
+namespace big_number {
+    chunks_view trim_chunks( chunks_view value ) {
+        size_t size = value.size();
+        while ( size > ZERO_INT && value[size - ONE_INT] == ZERO_INT )
+            --size;
+        return value.first( size );
+    }
+
+    int compare_chunks( chunks_view lhs, chunks_view rhs ) {
+        lhs = trim_chunks( lhs );
+        rhs = trim_chunks( rhs );
+
+        if ( lhs.size() != rhs.size() )
+            return lhs.size() < rhs.size() ? -1 : 1;
+
+        for ( size_t i = lhs.size(); i-- > ZERO_INT; ) {
+            if ( lhs[i] != rhs[i] ) return lhs[i] < rhs[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    chunks add_chunks( chunks_view lhs, chunks_view rhs ) {
+        if ( lhs.size() < rhs.size() ) std::swap( lhs, rhs );
+
+        chunks result( lhs.size() + ONE_INT, ZERO_INT );
+        std::ranges::copy( lhs, result.begin() );
+        result.back() =
+            add_chunks_into( chunks_span( result ).first( lhs.size() ), rhs );
+
+        if ( result.back() == ZERO_INT ) result.pop_back();
+        return result;
+    }
+
+    chunks sub_chunks( chunks_view minuend, chunks_view subtrahend ) {
+        chunks result( minuend.begin(), minuend.end() );
+        sub_chunks_into( result, trim_chunks( subtrahend ) );
+
+        result.resize( trim_chunks( result ).size() );
+        return result;
+    }
+
+    chunks mul_chunks_small( chunks_view value, chunk factor ) {
+        chunks result( value.size() + ONE_INT, ZERO_INT );
+        chunk carry = 0;
+
+        for ( size_t i = 0; i < value.size(); ++i ) {
+            mul_chunk product =
+                static_cast<mul_chunk>( value[i] ) * factor + carry;
+            result[i] = static_cast<chunk>( product % MAX_CHUNK );
+            carry = static_cast<chunk>( product / MAX_CHUNK );
+        }
+
+        result.back() = carry;
+        if ( carry == ZERO_INT ) result.pop_back();
+        return result;
+    }
+
+    chunk add_chunks_into( chunks_span target, chunks_view value ) {
+        chunk carry = 0;
+        size_t i = 0;
+
+        for ( ; i < value.size(); ++i ) {
+            chunk sum = target[i] + value[i] + carry;
+            carry = sum >= MAX_CHUNK;
+            target[i] = sum - carry * MAX_CHUNK;
+        }
+
+        for ( ; carry != ZERO_INT && i < target.size(); ++i ) {
+            chunk sum = target[i] + carry;
+            carry = sum >= MAX_CHUNK;
+            target[i] = sum - carry * MAX_CHUNK;
+        }
+
+        return carry;
+    }
+
+    chunk sub_chunks_into( chunks_span target, chunks_view value ) {
+        chunk borrow = 0;
+        size_t i = 0;
+
+        for ( ; i < value.size(); ++i ) {
+            chunk subtrahend = value[i] + borrow;
+            borrow = target[i] < subtrahend;
+            target[i] = target[i] + borrow * MAX_CHUNK - subtrahend;
+        }
+
+        for ( ; borrow != ZERO_INT && i < target.size(); ++i ) {
+            borrow = target[i] == ZERO_INT;
+            target[i] = target[i] + borrow * MAX_CHUNK - ONE_INT;
+        }
+
+        return borrow;
+    }
+
+    chunk add_chunks_to( chunks_span out,
+                         chunks_view lhs,
+                         chunks_view rhs,
+                         chunk carry ) {
+        for ( size_t i = 0; i < out.size(); ++i ) {
+            chunk sum = lhs[i] + rhs[i] + carry;
+            carry = sum >= MAX_CHUNK;
+            out[i] = sum - carry * MAX_CHUNK;
+        }
+        return carry;
+    }
+
+    chunk sub_chunks_to( chunks_span out,
+                         chunks_view minuend,
+                         chunks_view subtrahend,
+                         chunk borrow ) {
+        for ( size_t i = 0; i < out.size(); ++i ) {
+            chunk value = subtrahend[i] + borrow;
+            borrow = minuend[i] < value;
+            out[i] = minuend[i] + borrow * MAX_CHUNK - value;
+        }
+        return borrow;
+    }
+
+    chunk negate_chunks_to( chunks_span out, chunks_view value ) {
+        chunk borrow = 0;
+        for ( size_t i = 0; i < out.size(); ++i ) {
+            chunk subtrahend = value[i] + borrow;
+            borrow = subtrahend != ZERO_INT;
+            out[i] = borrow * MAX_CHUNK - subtrahend;
+        }
+        return borrow;
+    }
+
+    // Once the carry dies out the rest of value is copied as is.
+    chunk propagate_carry( chunks_span out, chunks_view value, chunk carry ) {
+        size_t i = 0;
+        for ( ; carry != ZERO_INT && i < value.size(); ++i ) {
+            chunk sum = value[i] + carry;
+            carry = sum >= MAX_CHUNK;
+            out[i] = sum - carry * MAX_CHUNK;
+        }
+        std::copy( value.begin() + i, value.end(), out.begin() + i );
+        return carry;
+    }
+
+    chunk propagate_borrow( chunks_span out, chunks_view value, chunk borrow ) {
+        size_t i = 0;
+        for ( ; borrow != ZERO_INT && i < value.size(); ++i ) {
+            borrow = value[i] == ZERO_INT;
+            out[i] = value[i] + borrow * MAX_CHUNK - ONE_INT;
+        }
+        std::copy( value.begin() + i, value.end(), out.begin() + i );
+        return borrow;
+    }
+
+    chunk div_chunks_small( chunks_span value, chunk divisor ) {
+        mul_chunk remainder = 0;
+
+        for ( size_t i = value.size(); i-- > ZERO_INT; ) {
+            mul_chunk current = remainder * MAX_CHUNK + value[i];
+            value[i] = static_cast<chunk>( current / divisor );
+            remainder = current % divisor;
+        }
+
+        return static_cast<chunk>( remainder );
+    }
+}
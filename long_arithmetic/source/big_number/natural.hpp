@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "big_number.hpp"
+
+namespace big_number {
+    // Helpers over raw magnitudes: little-endian base 10^18 chunk arrays
+    // without sign, shift or special values.
+    using chunks_view = std::span<const chunk>;
+    using chunks_span = std::span<chunk>;
+
+    chunks_view trim_chunks( chunks_view value );
+
+    int compare_chunks( chunks_view lhs, chunks_view rhs );
+
+    chunks add_chunks( chunks_view lhs, chunks_view rhs );
+
+    chunks sub_chunks( chunks_view minuend, chunks_view subtrahend );
+
+    chunks mul_chunks_small( chunks_view value, chunk factor );
+
+    chunk add_chunks_into( chunks_span target, chunks_view value );
+
+    chunk sub_chunks_into( chunks_span target, chunks_view value );
+
+    // Kernels writing into out, which is as long as the inputs; each
+    // takes and returns the carry or borrow.
+    chunk add_chunks_to( chunks_span out,
+                         chunks_view lhs,
+                         chunks_view rhs,
+                         chunk carry );
+
+    chunk sub_chunks_to( chunks_span out,
+                         chunks_view minuend,
+                         chunks_view subtrahend,
+                         chunk borrow );
+
+    chunk negate_chunks_to( chunks_span out, chunks_view value );
+
+    chunk propagate_carry( chunks_span out, chunks_view value, chunk carry );
+
+    chunk propagate_borrow( chunks_span out, chunks_view value, chunk borrow );
+
+    chunk div_chunks_small( chunks_span value, chunk divisor );
+}
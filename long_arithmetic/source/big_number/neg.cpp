@@ -1,3 +1,5 @@
+#include <utility>
+
 #include "big_number.hpp"
 #include "constructors.hpp"
 #include "getters.hpp"
@@ -10,4 +12,19 @@ namespace big_number {
                                 get_error( number ),
                                 !is_negative( number ) );
     }
+
+    // The mantissa is moved through, so only the sign changes.
+    BigNumber neg( BigNumber&& number ) {
+        return make_big_number( std::move( number.mantissa ),
+                                get_shift( number ),
+                                get_type( number ),
+                                get_error( number ),
+                                !is_negative( number ) );
+    }
+
+    BigNumberView neg( const BigNumberView& number ) {
+        BigNumberView result = number;
+        result.is_negative = !is_negative( number );
+        return result;
+    }
 }
@@ -0,0 +1,868 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "constants.hpp"
+#include "montgomery.hpp"
+#include "mul.hpp"
+#include "natural.hpp"
+#include "ntt_simd.hpp"
+#include "worker_pool.hpp"
+
+namespace big_number {
+    constexpr uint32_t MOD1 = 998244353;
+    constexpr uint32_t MOD2 = 1004535809;
+    constexpr uint32_t MOD3 = 469762049;
+    constexpr uint32_t MOD4 = 1224736769;
+    constexpr uint32_t MOD5 = 167772161;
+    constexpr uint32_t ROOT = 3;
+
+    constexpr std::array<uint32_t, MAX_NTT_MODULI> MODULI = {
+        MOD1, MOD2, MOD3, MOD4, MOD5 };
+
+    constexpr uint32_t mod_pow( uint64_t a, uint64_t e, uint32_t mod ) {
+        uint64_t res = 1, base = a % mod;
+        while ( e ) {
+            if ( e & 1 ) res = ( res * base ) % mod;
+            base = ( base * base ) % mod;
+            e >>= 1;
+        }
+        return static_cast<uint32_t>( res );
+    }
+
+    // Roots of unity for every butterfly stage, built once per modulus and
+    // stage length and shared by all transforms: level k holds the 2^k
+    // twiddles of the stage of length 2^(k+1), in Montgomery form.
+    constexpr size_t MAX_NTT_LEVELS = 32;
+
+    // A modulus has roots of unity of order 2^k for every 2^k dividing
+    // MOD - 1, so the smallest such power among the moduli bounds the
+    // transform length.
+    constexpr size_t max_ntt_order() {
+        size_t order = MAX_NTT_LEVELS;
+        for ( uint32_t modulus : MODULI ) {
+            order = std::min<size_t>( order, std::countr_zero( modulus - 1 ) );
+        }
+        return order;
+    }
+
+    constexpr size_t MAX_NTT_LENGTH = size_t( 1 ) << max_ntt_order();
+
+    // Whole-chunk products of the longest values need 2 * MAX_CHUNKS
+    // residues, which must fit a single transform.
+    static_assert( 2 * MAX_CHUNKS <= MAX_NTT_LENGTH,
+                   "NTT moduli are too short for MAX_CHUNKS products" );
+
+    struct TwiddleCache {
+        std::array<std::once_flag, MAX_NTT_LEVELS> built;
+        std::array<std::vector<uint32_t>, MAX_NTT_LEVELS> forward;
+        std::array<std::vector<uint32_t>, MAX_NTT_LEVELS> inverse;
+    };
+
+    template <uint32_t MOD>
+    std::vector<uint32_t> build_twiddles( uint32_t root, size_t count ) {
+        using M = Montgomery<MOD>;
+        std::vector<uint32_t> twiddles( count );
+        uint32_t w = M::to_montgomery( 1 );
+        uint32_t step = M::to_montgomery( root );
+
+        for ( uint32_t& twiddle : twiddles ) {
+            twiddle = w;
+            w = M::mul( w, step );
+        }
+        return twiddles;
+    }
+
+    template <uint32_t MOD>
+    const uint32_t* get_twiddles( size_t half, bool invert ) {
+        static TwiddleCache cache;
+        size_t level = std::countr_zero( half );
+
+        std::call_once( cache.built[level], [&] {
+            uint32_t root = mod_pow( ROOT, ( MOD - 1 ) / ( half << 1 ), MOD );
+            cache.forward[level] = build_twiddles<MOD>( root, half );
+            cache.inverse[level] =
+                build_twiddles<MOD>( mod_pow( root, MOD - 2, MOD ), half );
+        } );
+
+        return invert ? cache.inverse[level].data()
+                      : cache.forward[level].data();
+    }
+
+    bool is_ntt_backend_supported( NttBackend backend ) {
+        switch ( backend ) {
+        case NttBackend::AUTO:
+        case NttBackend::SCALAR:
+            return true;
+#if BIG_NUMBER_HAS_SIMD_NTT
+        case NttBackend::AVX2:
+            return __builtin_cpu_supports( "avx2" );
+        case NttBackend::AVX512:
+            return __builtin_cpu_supports( "avx512f" ) &&
+                   __builtin_cpu_supports( "avx2" );
+#endif
+        default:
+            return false;
+        }
+    }
+
+    NttBackend detect_ntt_backend() {
+        if ( is_ntt_backend_supported( NttBackend::AVX512 ) )
+            return NttBackend::AVX512;
+        if ( is_ntt_backend_supported( NttBackend::AVX2 ) )
+            return NttBackend::AVX2;
+        return NttBackend::SCALAR;
+    }
+
+    std::atomic<NttBackend>& active_ntt_backend() {
+        static std::atomic<NttBackend> backend{ detect_ntt_backend() };
+        return backend;
+    }
+
+    NttBackend get_ntt_backend() { return active_ntt_backend().load(); }
+
+    bool set_ntt_backend( NttBackend backend ) {
+        if ( !is_ntt_backend_supported( backend ) ) return false;
+
+        if ( backend == NttBackend::AUTO ) backend = detect_ntt_backend();
+        active_ntt_backend().store( backend );
+        return true;
+    }
+
+    // count butterflies (low[j], high[j]) sharing the twiddles[j]: forward
+    // transforms decimate in frequency, inverse ones in time.
+    template <uint32_t MOD, bool IS_DIF>
+    void ntt_butterflies( uint32_t* low,
+                          uint32_t* high,
+                          size_t count,
+                          const uint32_t* twiddles,
+                          NttBackend backend ) {
+#if BIG_NUMBER_HAS_SIMD_NTT
+        if ( backend == NttBackend::AVX512 && count % 16 == 0 ) {
+            return ntt_butterflies_avx512<MOD, IS_DIF>(
+                low, high, count, twiddles );
+        }
+        if ( backend != NttBackend::SCALAR && count % 8 == 0 ) {
+            return ntt_butterflies_avx2<MOD, IS_DIF>(
+                low, high, count, twiddles );
+        }
+#endif
+        using M = Montgomery<MOD>;
+        for ( size_t j = 0; j < count; ++j ) {
+            uint32_t u = low[j];
+            uint32_t v = high[j];
+
+            if constexpr ( IS_DIF ) {
+                low[j] = M::add( u, v );
+                high[j] = M::mul( M::sub( u, v ), twiddles[j] );
+            } else {
+                v = M::mul( v, twiddles[j] );
+                low[j] = M::add( u, v );
+                high[j] = M::sub( u, v );
+            }
+        }
+    }
+
+    // Stages shorter than a register use the permuting kernels.
+    template <uint32_t MOD, bool IS_DIF>
+    void ntt_stage( uint32_t* a,
+                    size_t n,
+                    size_t half,
+                    const uint32_t* twiddles,
+                    NttBackend backend ) {
+#if BIG_NUMBER_HAS_SIMD_NTT
+        if ( backend == NttBackend::AVX512 && half < 16 && n >= 32 )
+            return ntt_small_stage_avx512<MOD, IS_DIF>( a, n, half, twiddles );
+        if ( backend != NttBackend::SCALAR && half < 8 && n >= 16 )
+            return ntt_small_stage_avx2<MOD, IS_DIF>( a, n, half, twiddles );
+#endif
+        for ( size_t i = 0; i < n; i += half << 1 ) {
+            ntt_butterflies<MOD, IS_DIF>(
+                a + i, a + i + half, half, twiddles, backend );
+        }
+    }
+
+    // a[i] = a[i] * b[i] * factor * R^-2, or a[i] * factor * R^-1 without b.
+    template <uint32_t MOD>
+    void mul_vector( uint32_t* a,
+                     const uint32_t* b,
+                     size_t n,
+                     uint32_t factor,
+                     NttBackend backend ) {
+#if BIG_NUMBER_HAS_SIMD_NTT
+        if ( backend == NttBackend::AVX512 && n % 16 == 0 )
+            return mul_vector_avx512<MOD>( a, b, n, factor );
+        if ( backend != NttBackend::SCALAR && n % 8 == 0 )
+            return mul_vector_avx2<MOD>( a, b, n, factor );
+#endif
+        using M = Montgomery<MOD>;
+        for ( size_t i = 0; i < n; ++i ) {
+            uint32_t value = b != nullptr ? M::mul( a[i], b[i] ) : a[i];
+            a[i] = M::mul( value, factor );
+        }
+    }
+
+    // Smallest slice of a transform or of the CRT pass handed to a thread.
+    constexpr size_t MIN_PARALLEL_SEGMENT = 4096;
+
+    // Residues per block whose stages run back to back while it stays in
+    // the L1 cache.
+    constexpr size_t NTT_BLOCK = 4096;
+
+    // How a transform of one multiplication is executed: the kernel set
+    // and the number of equal power-of-two segments it is split into.
+    struct NttContext {
+        NttBackend backend;
+        WorkerPool* pool;
+        size_t parts;
+    };
+
+    // Every stage shorter than block, run depth-first on each block of the
+    // n residues at a.
+    template <uint32_t MOD, bool IS_DIF>
+    void ntt_blocks( uint32_t* a, size_t n, size_t block, NttBackend backend ) {
+        for ( uint32_t* data = a; data < a + n; data += block ) {
+            if constexpr ( IS_DIF ) {
+                for ( size_t half = block / 2; half > ZERO_INT; half >>= 1 ) {
+                    ntt_stage<MOD, true>( data,
+                                          block,
+                                          half,
+                                          get_twiddles<MOD>( half, false ),
+                                          backend );
+                }
+            } else {
+                for ( size_t half = 1; half < block; half <<= 1 ) {
+                    ntt_stage<MOD, false>( data,
+                                           block,
+                                           half,
+                                           get_twiddles<MOD>( half, true ),
+                                           backend );
+                }
+            }
+        }
+    }
+
+    // The butterflies [begin, end) of a stage, numbered block by block.
+    template <uint32_t MOD, bool IS_DIF>
+    void ntt_stage_slice( uint32_t* a,
+                          size_t half,
+                          size_t begin,
+                          size_t end,
+                          const uint32_t* twiddles,
+                          NttBackend backend ) {
+        while ( begin < end ) {
+            size_t j = begin % half;
+            size_t count = std::min( half - j, end - begin );
+            uint32_t* low = a + begin / half * 2 * half + j;
+
+            ntt_butterflies<MOD, IS_DIF>(
+                low, low + half, count, twiddles + j, backend );
+            begin += count;
+        }
+    }
+
+    // Forward transforms decimate in frequency and leave the residues in
+    // bit-reversed order, which inverse transforms decimate in time back
+    // from, so no permutation pass is needed. Stages shorter than a block
+    // run on each block of a part's segment at once; each longer stage
+    // still streams over the whole vector, and part p takes its p-th share
+    // of the n / 2 butterflies.
+    template <uint32_t MOD, bool IS_DIF>
+    void ntt_transform( std::vector<uint32_t>& a, const NttContext& context ) {
+        size_t n = a.size();
+        size_t parts = std::min( context.parts, n );
+        size_t segment = n / parts;
+        size_t block = std::min( segment, NTT_BLOCK );
+
+        auto run_blocks = [&] {
+            run_parallel( context.pool, parts, [&]( size_t part ) {
+                uint32_t* data = a.data() + part * segment;
+                ntt_blocks<MOD, IS_DIF>(
+                    data, segment, block, context.backend );
+            } );
+        };
+        auto run_stage = [&]( size_t half ) {
+            const uint32_t* twiddles = get_twiddles<MOD>( half, !IS_DIF );
+            run_parallel( context.pool, parts, [&]( size_t part ) {
+                ntt_stage_slice<MOD, IS_DIF>( a.data(),
+                                              half,
+                                              part * segment / 2,
+                                              ( part + ONE_INT ) * segment / 2,
+                                              twiddles,
+                                              context.backend );
+            } );
+        };
+
+        if constexpr ( IS_DIF ) {
+            for ( size_t half = n / 2; half >= block; half >>= 1 )
+                run_stage( half );
+            run_blocks();
+        } else {
+            run_blocks();
+            for ( size_t half = block; half < n; half <<= 1 )
+                run_stage( half );
+        }
+    }
+
+    template <uint32_t MOD>
+    void ntt_mod( std::vector<uint32_t>& a,
+                  bool invert,
+                  const NttContext& context ) {
+        if ( !invert ) return ntt_transform<MOD, true>( a, context );
+        ntt_transform<MOD, false>( a, context );
+
+        using M = Montgomery<MOD>;
+        size_t n = a.size();
+        size_t parts = std::min( context.parts, n );
+        size_t segment = n / parts;
+        uint32_t inv_n = M::to_montgomery( mod_pow( n, MOD - 2, MOD ) );
+
+        run_parallel( context.pool, parts, [&]( size_t part ) {
+            mul_vector<MOD>( a.data() + part * segment,
+                             nullptr,
+                             segment,
+                             inv_n,
+                             context.backend );
+        } );
+    }
+
+    // Both factors are plain residues, so the Montgomery product carries an
+    // extra R^-1 that the multiplication by R^2 cancels.
+    template <uint32_t MOD>
+    void pointwise_mul( std::vector<uint32_t>& a,
+                        const std::vector<uint32_t>& b,
+                        const NttContext& context ) {
+        size_t parts = std::min( context.parts, a.size() );
+        size_t segment = a.size() / parts;
+
+        run_parallel( context.pool, parts, [&]( size_t part ) {
+            mul_vector<MOD>( a.data() + part * segment,
+                             b.data() + part * segment,
+                             segment,
+                             Montgomery<MOD>::R2,
+                             context.backend );
+        } );
+    }
+
+    // Forward butterflies add and subtract their inputs before any
+    // Montgomery reduction, so the residues start below MOD.
+    template <uint32_t MOD>
+    void to_base1e9( chunks_view c, std::span<uint32_t> d ) {
+        for ( size_t i = 0; i < c.size(); ++i ) {
+            d[2 * i] = c[i] % 1000000000ULL % MOD;
+            d[2 * i + 1] = c[i] / 1000000000ULL % MOD;
+        }
+    }
+
+    template <uint32_t MOD>
+    void to_residues( chunks_view c, std::span<uint32_t> d ) {
+        for ( size_t i = 0; i < c.size(); ++i )
+            d[i] = c[i] % MOD;
+    }
+
+    constexpr uint64_t DIGIT_BASE = 1000000000;
+    constexpr uint64_t MOD12 = static_cast<uint64_t>( MOD1 ) * MOD2;
+    constexpr uint64_t INV_MOD1 = mod_pow( MOD1, MOD2 - 2, MOD2 );
+    constexpr uint64_t INV_MOD12 = mod_pow( MOD12 % MOD3, MOD3 - 2, MOD3 );
+
+    // MOD1 * MOD2 in base 10^9.
+    constexpr uint64_t MOD12_DIGITS[3] = { MOD12 % DIGIT_BASE,
+                                           MOD12 / DIGIT_BASE % DIGIT_BASE,
+                                           MOD12 / DIGIT_BASE / DIGIT_BASE };
+
+    // Garner's reconstruction x = x12 + t * MOD1 * MOD2 of one coefficient,
+    // split as low + middle * 10^9 + high * 10^18 so that every term fits 64
+    // bits and is only ever divided by constants.
+    struct CrtTerms {
+        uint64_t low;
+        uint64_t middle;
+        uint64_t high;
+    };
+
+    CrtTerms crt3_terms( uint32_t r1, uint32_t r2, uint32_t r3 ) {
+        uint64_t t = ( r2 + static_cast<uint64_t>( MOD2 ) - r1 ) * INV_MOD1;
+        uint64_t x12 = r1 + t % MOD2 * MOD1;
+
+        t = ( r3 + static_cast<uint64_t>( MOD3 ) - x12 % MOD3 ) * INV_MOD12;
+        t %= MOD3;
+
+        return { x12 % DIGIT_BASE + t * MOD12_DIGITS[0],
+                 x12 / DIGIT_BASE + t * MOD12_DIGITS[1],
+                 t * MOD12_DIGITS[2] };
+    }
+
+    // Chunks the stream of one segment carries into the next segment.
+    using CrtCarry = std::array<chunk, 2>;
+
+    // Streams the chunks [begin, end) of product from the coefficients
+    // [2 * begin, 2 * end) in one pass, packing each pair of base 10^9
+    // digits as soon as it is complete. Starts from a zero carry.
+    CrtCarry crt3_stream( const NttTransforms& residues,
+                          size_t begin,
+                          size_t end,
+                          chunks_span product ) {
+        uint64_t current = 0;
+        uint64_t next = 0;
+        uint64_t low_digit = 0;
+
+        for ( size_t i = 2 * begin; i < 2 * end; ++i ) {
+            CrtTerms terms = crt3_terms(
+                residues[0][i], residues[1][i], residues[2][i] );
+            current += terms.low;
+
+            uint64_t digit = current % DIGIT_BASE;
+            current = next + terms.middle + current / DIGIT_BASE;
+            next = terms.high;
+
+            if ( i % 2 == ZERO_INT ) {
+                low_digit = digit;
+            } else {
+                product[i / 2] = digit * DIGIT_BASE + low_digit;
+            }
+        }
+
+        uint64_t carry = current + next * DIGIT_BASE;
+        return { carry % MAX_CHUNK, carry / MAX_CHUNK };
+    }
+
+    // Inverses modulo MOD of every modulus but MOD itself, in Montgomery
+    // form.
+    template <uint32_t MOD>
+    constexpr std::array<uint32_t, MAX_NTT_MODULI> garner_inverses() {
+        std::array<uint32_t, MAX_NTT_MODULI> inverses{};
+        for ( size_t i = 0; i < MAX_NTT_MODULI; ++i ) {
+            inverses[i] = Montgomery<MOD>::to_montgomery(
+                mod_pow( MODULI[i], MOD - 2, MOD ) );
+        }
+        return inverses;
+    }
+
+    // Garner's mixed-radix digit modulo MOD of a coefficient whose digits
+    // for the first count moduli are known. Adding a multiple of MOD above
+    // MOD4, the largest modulus, keeps x - digit nonnegative and below 2^32
+    // without reducing the digit first.
+    template <uint32_t MOD>
+    uint32_t garner_digit( uint32_t residue,
+                           const std::array<uint32_t, MAX_NTT_MODULI>& digits,
+                           size_t count ) {
+        using M = Montgomery<MOD>;
+        static constexpr std::array<uint32_t, MAX_NTT_MODULI> inverses =
+            garner_inverses<MOD>();
+        constexpr uint32_t offset = ( MOD4 + MOD - ONE_INT ) / MOD * MOD;
+
+        uint32_t x = residue;
+        for ( size_t i = 0; i < count; ++i )
+            x = M::mul( x + offset - digits[i], inverses[i] );
+        return x;
+    }
+
+    using CrtDigits = std::array<uint64_t, MAX_NTT_MODULI>;
+
+    // MOD1 * ... * MODk in base 10^9 for k from 0 to 4.
+    constexpr std::array<CrtDigits, MAX_NTT_MODULI> moduli_prefixes() {
+        std::array<CrtDigits, MAX_NTT_MODULI> prefixes{};
+        CrtDigits prefix{ 1 };
+
+        for ( size_t k = 0; k < MAX_NTT_MODULI; ++k ) {
+            prefixes[k] = prefix;
+            uint64_t carry = 0;
+            for ( uint64_t& digit : prefix ) {
+                uint64_t value = digit * MODULI[k] + carry;
+                digit = value % DIGIT_BASE;
+                carry = value / DIGIT_BASE;
+            }
+        }
+        return prefixes;
+    }
+
+    // The coefficient t0 + t1 * MOD1 + t2 * MOD1 * MOD2 + ... in base 10^9.
+    // The column sums stay below the sum of the moduli times 10^9, so they
+    // are formed independently and normalized by a single carry pass; the
+    // five moduli multiply to less than 10^45, so nothing is left over.
+    CrtDigits crt5_digits( const NttTransforms& residues, size_t i ) {
+        static constexpr std::array<CrtDigits, MAX_NTT_MODULI> prefixes =
+            moduli_prefixes();
+
+        std::array<uint32_t, MAX_NTT_MODULI> t;
+        t[0] = residues[0][i];
+        t[1] = garner_digit<MOD2>( residues[1][i], t, 1 );
+        t[2] = garner_digit<MOD3>( residues[2][i], t, 2 );
+        t[3] = garner_digit<MOD4>( residues[3][i], t, 3 );
+        t[4] = garner_digit<MOD5>( residues[4][i], t, 4 );
+
+        CrtDigits digits{};
+        for ( size_t k = 0; k < MAX_NTT_MODULI; ++k ) {
+            for ( size_t d = 0; d < MAX_NTT_MODULI; ++d )
+                digits[d] += t[k] * prefixes[k][d];
+        }
+
+        uint64_t carry = 0;
+        for ( uint64_t& digit : digits ) {
+            digit += carry;
+            carry = digit / DIGIT_BASE;
+            digit %= DIGIT_BASE;
+        }
+        return digits;
+    }
+
+    // Streams the chunks [begin, end) of product from whole-chunk
+    // coefficients. Each one spans three chunks, the last below 10^9, so
+    // the two pending chunk sums stay below 2^64.
+    CrtCarry crt5_stream( const NttTransforms& residues,
+                          size_t begin,
+                          size_t end,
+                          chunks_span product ) {
+        uint64_t current = 0;
+        uint64_t next = 0;
+
+        for ( size_t i = begin; i < end; ++i ) {
+            CrtDigits digits = crt5_digits( residues, i );
+            current += digits[1] * DIGIT_BASE + digits[0];
+            next += digits[3] * DIGIT_BASE + digits[2];
+
+            product[i] = current % MAX_CHUNK;
+            current = next + current / MAX_CHUNK;
+            next = digits[4];
+        }
+
+        return { current % MAX_CHUNK, current / MAX_CHUNK + next };
+    }
+
+    // Segments are streamed in parallel, then the carry out of each one is
+    // added at the start of the next. The product fits in its chunks, so
+    // the coefficients past them are zero and no carry leaves the last one.
+    template <typename Stream>
+    void from_ntt_crt( std::vector<CrtCarry>& carries,
+                       WorkerPool* pool,
+                       size_t parts,
+                       chunks_span product,
+                       const Stream& stream ) {
+        size_t size = product.size();
+        size_t segment = ( size + parts - ONE_INT ) / parts;
+
+        carries.resize( parts );
+        run_parallel( pool, parts, [&]( size_t part ) {
+            size_t begin = std::min( size, part * segment );
+            size_t end = std::min( size, begin + segment );
+            carries[part] = stream( begin, end );
+        } );
+
+        for ( size_t part = 0; part + ONE_INT < parts; ++part ) {
+            size_t end = std::min( size, ( part + ONE_INT ) * segment );
+            add_chunks_into( product.subspan( end ), carries[part] );
+        }
+    }
+
+    // Scratch buffers of the NTT products run by one thread. They only grow,
+    // so repeated products of a length allocate nothing.
+    struct NttWorkspace {
+        NttTransforms residues;
+        NttTransforms operand;
+        NttTransforms piece;
+        std::vector<CrtCarry> carries;
+        bool is_busy = false;
+    };
+
+    // Marks the workspace of this thread as taken for its lifetime, so it is
+    // released again when a task throws.
+    struct NttWorkspaceLock {
+        explicit NttWorkspaceLock( NttWorkspace& workspace )
+            : workspace( workspace ) {
+            workspace.is_busy = true;
+        }
+        ~NttWorkspaceLock() { workspace.is_busy = false; }
+
+        NttWorkspaceLock( const NttWorkspaceLock& ) = delete;
+        NttWorkspaceLock& operator=( const NttWorkspaceLock& ) = delete;
+
+        NttWorkspace& workspace;
+    };
+
+    // A thread waiting for its pool batch may run queued tasks that multiply
+    // on their own; such a nested product gets a temporary workspace.
+    template <typename Task>
+    void with_ntt_workspace( const Task& task ) {
+        thread_local NttWorkspace workspace;
+        if ( workspace.is_busy ) {
+            NttWorkspace temporary;
+            return task( temporary );
+        }
+
+        NttWorkspaceLock lock( workspace );
+        task( workspace );
+    }
+
+    // Products of at least this many chunks transform whole chunks under
+    // five moduli: half the transform length for two more pipelines and a
+    // costlier CRT. The five moduli multiply to more than a sum of 2^26
+    // products of two chunks, more terms than MAX_NTT_LENGTH allows.
+    constexpr size_t NTT_WHOLE_CHUNK_THRESHOLD = 3000;
+
+    // How a product of coefficients residues is executed on transforms of
+    // n residues. The second operand goes through in pieces of piece chunks,
+    // all of it at once unless that would pad too much. With more than one
+    // thread the modulus pipelines run concurrently and share the remaining
+    // threads for their transforms.
+    struct NttPlan {
+        size_t n;
+        size_t moduli;
+        size_t piece;
+        size_t coefficients;
+        std::shared_ptr<WorkerPool> pool;
+        NttContext context;
+        size_t crt_parts;
+    };
+
+    size_t coefficients_per_chunk( size_t moduli ) {
+        return moduli == MAX_NTT_MODULI ? 1 : 2;
+    }
+
+    // Butterflies of a transform plus a linear pass over it.
+    size_t ntt_cost( size_t n ) {
+        return n * ( std::countr_zero( n ) + ONE_INT );
+    }
+
+    size_t ntt_moduli( size_t kept_size, size_t split_size ) {
+        return kept_size + split_size >= NTT_WHOLE_CHUNK_THRESHOLD
+                   ? MAX_NTT_MODULI
+                   : 3;
+    }
+
+    // Whether plan_ntt() finds a transform of at most MAX_NTT_LENGTH: kept
+    // and one chunk of the other operand must fit, or all of a square.
+    bool fits_ntt( size_t kept_size, size_t split_size, bool can_split ) {
+        size_t per_chunk =
+            coefficients_per_chunk( ntt_moduli( kept_size, split_size ) );
+        size_t size = can_split ? kept_size + ONE_INT : kept_size + split_size;
+        return per_chunk * size <= MAX_NTT_LENGTH;
+    }
+
+    // Padding a product to the next power of two can nearly double its
+    // transforms. A transform half or a quarter as long that holds kept and
+    // a piece of the other operand costs one forward and one inverse
+    // transform per piece instead, and kept is transformed once.
+    // Products too long for one transform always go in pieces; the caller
+    // checks fits_ntt() first.
+    NttPlan plan_ntt( size_t kept_size, size_t split_size, bool can_split ) {
+        size_t moduli = ntt_moduli( kept_size, split_size );
+        size_t per_chunk = coefficients_per_chunk( moduli );
+        size_t coefficients = per_chunk * ( kept_size + split_size );
+
+        size_t padded = std::bit_ceil( coefficients );
+        size_t n = padded;
+        size_t piece = split_size;
+        size_t cost =
+            padded <= MAX_NTT_LENGTH ? 3 * ntt_cost( n ) : SIZE_MAX;
+        size_t longest = std::min( padded / 2, MAX_NTT_LENGTH );
+        size_t shortest = std::min( padded / 4, MAX_NTT_LENGTH );
+
+        for ( size_t length = longest; can_split && length >= shortest;
+              length /= 2 ) {
+            if ( length / per_chunk <= kept_size ) break;
+
+            size_t candidate = length / per_chunk - kept_size;
+            size_t pieces = ( split_size + candidate - ONE_INT ) / candidate;
+            size_t candidate_cost =
+                ( 2 * pieces + ONE_INT ) * ntt_cost( length );
+
+            if ( candidate_cost < cost ) {
+                n = length;
+                piece = candidate;
+                cost = candidate_cost;
+            }
+        }
+
+        size_t threads = get_mul_threads();
+        size_t max_parts = std::max<size_t>( n / MIN_PARALLEL_SEGMENT, 1 );
+        std::shared_ptr<WorkerPool> pool =
+            threads > ONE_INT ? get_mul_pool() : nullptr;
+
+        size_t pipeline_threads = std::max<size_t>( threads / moduli, 1 );
+        NttContext context{ get_ntt_backend(),
+                            pool.get(),
+                            std::min( std::bit_floor( pipeline_threads ),
+                                      max_parts ) };
+
+        return { n,
+                 moduli,
+                 piece,
+                 coefficients,
+                 pool,
+                 context,
+                 std::min( threads, max_parts ) };
+    }
+
+    // Calls task.operator()<MOD>( index ) for the first plan.moduli moduli.
+    template <typename Task>
+    void for_each_modulus( const NttPlan& plan, const Task& task ) {
+        run_parallel( plan.pool.get(), plan.moduli, [&]( size_t modulus ) {
+            if ( modulus == 0 ) task.template operator()<MOD1>( 0 );
+            if ( modulus == 1 ) task.template operator()<MOD2>( 1 );
+            if ( modulus == 2 ) task.template operator()<MOD3>( 2 );
+            if ( modulus == 3 ) task.template operator()<MOD4>( 3 );
+            if ( modulus == 4 ) task.template operator()<MOD5>( 4 );
+        } );
+    }
+
+    template <uint32_t MOD>
+    void forward_ntt( chunks_view value,
+                      const NttPlan& plan,
+                      std::vector<uint32_t>& residues ) {
+        residues.resize( plan.n );
+        if ( plan.moduli == MAX_NTT_MODULI ) {
+            to_residues<MOD>( value, residues );
+        } else {
+            to_base1e9<MOD>( value, residues );
+        }
+
+        size_t used = value.size() * coefficients_per_chunk( plan.moduli );
+        std::fill( residues.begin() + used, residues.end(), ZERO_INT );
+        ntt_mod<MOD>( residues, false, plan.context );
+    }
+
+    // residues = kept * value, where kept is transformed: each piece of
+    // value is transformed, multiplied and added at its offset.
+    template <uint32_t MOD>
+    void multiply_pieces( const std::vector<uint32_t>& kept,
+                          chunks_view value,
+                          const NttPlan& plan,
+                          std::vector<uint32_t>& piece,
+                          std::vector<uint32_t>& residues ) {
+        if ( value.size() <= plan.piece ) {
+            forward_ntt<MOD>( value, plan, residues );
+            pointwise_mul<MOD>( residues, kept, plan.context );
+            ntt_mod<MOD>( residues, true, plan.context );
+            return;
+        }
+
+        using M = Montgomery<MOD>;
+        size_t per_chunk = coefficients_per_chunk( plan.moduli );
+        residues.assign( plan.coefficients, ZERO_INT );
+
+        for ( size_t offset = 0; offset < value.size(); offset += plan.piece ) {
+            size_t size = std::min( plan.piece, value.size() - offset );
+            forward_ntt<MOD>( value.subspan( offset, size ), plan, piece );
+            pointwise_mul<MOD>( piece, kept, plan.context );
+            ntt_mod<MOD>( piece, true, plan.context );
+
+            uint32_t* target = residues.data() + offset * per_chunk;
+            size_t count =
+                std::min( plan.n, residues.size() - offset * per_chunk );
+            for ( size_t i = 0; i < count; ++i )
+                target[i] = M::add( target[i], piece[i] );
+        }
+    }
+
+    void write_ntt_product( const NttPlan& plan,
+                            NttWorkspace& workspace,
+                            chunks_span product ) {
+        const NttTransforms& residues = workspace.residues;
+        auto stream = [&]( size_t begin, size_t end ) {
+            if ( plan.moduli == MAX_NTT_MODULI )
+                return crt5_stream( residues, begin, end, product );
+            return crt3_stream( residues, begin, end, product );
+        };
+
+        from_ntt_crt( workspace.carries,
+                      plan.pool.get(),
+                      plan.crt_parts,
+                      product,
+                      stream );
+    }
+
+    // A square transforms its single operand once per modulus. Otherwise
+    // the shorter operand is kept and the longer one may go in pieces.
+    void ntt_product_into( chunks_view lhs,
+                           chunks_view rhs,
+                           bool is_square,
+                           chunks_span product ) {
+        if ( lhs.size() > rhs.size() ) std::swap( lhs, rhs );
+        if ( !fits_ntt( lhs.size(), rhs.size(), !is_square ) ) {
+            if ( is_square ) return karatsuba_sqr_into( lhs, product );
+            return karatsuba_mul_into( lhs, rhs, product );
+        }
+        NttPlan plan = plan_ntt( lhs.size(), rhs.size(), !is_square );
+
+        with_ntt_workspace( [&]( NttWorkspace& workspace ) {
+            for_each_modulus( plan, [&]<uint32_t MOD>( size_t modulus ) {
+                std::vector<uint32_t>& residues = workspace.residues[modulus];
+                if ( is_square ) {
+                    forward_ntt<MOD>( lhs, plan, residues );
+                    pointwise_mul<MOD>( residues, residues, plan.context );
+                    ntt_mod<MOD>( residues, true, plan.context );
+                    return;
+                }
+
+                std::vector<uint32_t>& kept = workspace.operand[modulus];
+                forward_ntt<MOD>( lhs, plan, kept );
+                multiply_pieces<MOD>( kept,
+                                      rhs,
+                                      plan,
+                                      workspace.piece[modulus],
+                                      residues );
+            } );
+
+            write_ntt_product( plan, workspace, product );
+        } );
+    }
+
+    void ntt_mul_into( chunks_view lhs, chunks_view rhs, chunks_span product ) {
+        ntt_product_into( lhs, rhs, false, product );
+    }
+
+    void ntt_sqr_into( chunks_view value, chunks_span product ) {
+        ntt_product_into( value, value, true, product );
+    }
+
+    // Concurrent first uses of a length may both transform; one result is
+    // kept and both are identical.
+    std::shared_ptr<const NttTransforms>
+    get_prepared_transforms( PreparedTransforms& prepared,
+                             chunks_view value,
+                             const NttPlan& plan ) {
+        {
+            std::lock_guard lock( prepared.mutex );
+            auto found = prepared.by_plan.find( { plan.n, plan.moduli } );
+            if ( found != prepared.by_plan.end() ) return found->second;
+        }
+
+        auto transforms = std::make_shared<NttTransforms>();
+        for_each_modulus( plan, [&]<uint32_t MOD>( size_t modulus ) {
+            forward_ntt<MOD>( value, plan, ( *transforms )[modulus] );
+        } );
+
+        std::lock_guard lock( prepared.mutex );
+        return prepared.by_plan
+            .try_emplace( { plan.n, plan.moduli }, std::move( transforms ) )
+            .first->second;
+    }
+
+    void ntt_mul_prepared_into( PreparedTransforms& prepared,
+                                chunks_view lhs,
+                                chunks_view rhs,
+                                chunks_span product ) {
+        if ( !fits_ntt( lhs.size(), rhs.size(), true ) )
+            return ntt_mul_into( lhs, rhs, product );
+
+        NttPlan plan = plan_ntt( lhs.size(), rhs.size(), true );
+        std::shared_ptr<const NttTransforms> cached =
+            get_prepared_transforms( prepared, lhs, plan );
+
+        with_ntt_workspace( [&]( NttWorkspace& workspace ) {
+            for_each_modulus( plan, [&]<uint32_t MOD>( size_t modulus ) {
+                multiply_pieces<MOD>( ( *cached )[modulus],
+                                      rhs,
+                                      plan,
+                                      workspace.piece[modulus],
+                                      workspace.residues[modulus] );
+            } );
+
+            write_ntt_product( plan, workspace, product );
+        } );
+    }
+}
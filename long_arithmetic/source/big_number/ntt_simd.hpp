@@ -0,0 +1,362 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "montgomery.hpp"
+
+#if defined( __x86_64__ )
+#    include <immintrin.h>
+#    define BIG_NUMBER_HAS_SIMD_NTT 1
+#else
+#    define BIG_NUMBER_HAS_SIMD_NTT 0
+#endif
+
+// Vectorized NTT kernels: 8 (AVX2) or 16 (AVX-512) residues per register.
+// Every function carries its own target attribute, so a library built for a
+// generic x86-64 target still contains them; ntt.cpp picks one at runtime.
+// Products are reduced in Montgomery form on the even and odd lanes
+// separately, then recombined with a blend. Butterfly kernels take IS_DIF:
+// forward transforms use the decimation-in-frequency butterfly
+// (u + v, (u - v) * w), inverse ones (u + v * w, u - v * w).
+namespace big_number {
+#if BIG_NUMBER_HAS_SIMD_NTT
+    // Short stages (half < lanes) pair values inside one register, so two
+    // registers (2 * lanes values) are regrouped with lane maps, where an
+    // index >= lanes selects from the second register. Butterfly p takes u
+    // from position lower[p] and v from upper[p].
+    inline void fill_butterfly_inputs( uint32_t* lower,
+                                       uint32_t* upper,
+                                       size_t lanes,
+                                       size_t half ) {
+        for ( size_t p = 0; p < lanes; ++p ) {
+            lower[p] = p / half * 2 * half + p % half;
+            upper[p] = lower[p] + half;
+        }
+    }
+
+    // The inverse maps: position q of the first (q < lanes) or second
+    // register receives the sum or the difference of its butterfly, taken
+    // from a register of sums followed by a register of differences.
+    inline void fill_butterfly_outputs( uint32_t* first,
+                                        uint32_t* second,
+                                        size_t lanes,
+                                        size_t half ) {
+        for ( size_t q = 0; q < 2 * lanes; ++q ) {
+            size_t butterfly = q / ( 2 * half ) * half + q % half;
+            bool is_difference = q % ( 2 * half ) >= half;
+            uint32_t source = butterfly + ( is_difference ? lanes : 0 );
+
+            if ( q < lanes ) {
+                first[q] = source;
+            } else {
+                second[q - lanes] = source;
+            }
+        }
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx2" )]] inline __m256i mont_mul_avx2( __m256i lhs,
+                                                            __m256i rhs ) {
+        const __m256i mod = _mm256_set1_epi32( MOD );
+        const __m256i neg_inverse =
+            _mm256_set1_epi32( Montgomery<MOD>::NEG_INVERSE );
+
+        __m256i even = _mm256_mul_epu32( lhs, rhs );
+        __m256i odd = _mm256_mul_epu32( _mm256_srli_epi64( lhs, 32 ),
+                                        _mm256_srli_epi64( rhs, 32 ) );
+
+        __m256i even_factor = _mm256_mul_epu32( even, neg_inverse );
+        __m256i odd_factor = _mm256_mul_epu32( odd, neg_inverse );
+        even = _mm256_add_epi64( even, _mm256_mul_epu32( even_factor, mod ) );
+        odd = _mm256_add_epi64( odd, _mm256_mul_epu32( odd_factor, mod ) );
+
+        __m256i result =
+            _mm256_blend_epi32( _mm256_srli_epi64( even, 32 ), odd, 0xAA );
+        return _mm256_min_epu32( result, _mm256_sub_epi32( result, mod ) );
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx2" )]] inline __m256i mont_add_avx2( __m256i lhs,
+                                                            __m256i rhs ) {
+        __m256i sum = _mm256_add_epi32( lhs, rhs );
+        return _mm256_min_epu32(
+            sum, _mm256_sub_epi32( sum, _mm256_set1_epi32( MOD ) ) );
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx2" )]] inline __m256i mont_sub_avx2( __m256i lhs,
+                                                            __m256i rhs ) {
+        __m256i difference = _mm256_sub_epi32( lhs, rhs );
+        return _mm256_min_epu32(
+            difference,
+            _mm256_add_epi32( difference, _mm256_set1_epi32( MOD ) ) );
+    }
+
+    // Sums and differences of one register of butterflies.
+    template <uint32_t MOD, bool IS_DIF>
+    [[gnu::target( "avx2" )]] inline void
+    butterfly_avx2( __m256i u,
+                    __m256i v,
+                    __m256i w,
+                    __m256i& sum,
+                    __m256i& difference ) {
+        if constexpr ( !IS_DIF ) v = mont_mul_avx2<MOD>( v, w );
+        sum = mont_add_avx2<MOD>( u, v );
+        difference = mont_sub_avx2<MOD>( u, v );
+        if constexpr ( IS_DIF )
+            difference = mont_mul_avx2<MOD>( difference, w );
+    }
+
+    // count butterflies (low[j], high[j]) with twiddles[j], count % 8 == 0.
+    template <uint32_t MOD, bool IS_DIF>
+    [[gnu::target( "avx2" )]] void
+    ntt_butterflies_avx2( uint32_t* low,
+                          uint32_t* high,
+                          size_t count,
+                          const uint32_t* twiddles ) {
+        for ( size_t j = 0; j < count; j += 8 ) {
+            __m256i* u_data = reinterpret_cast<__m256i*>( low + j );
+            __m256i* v_data = reinterpret_cast<__m256i*>( high + j );
+            __m256i w = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>( twiddles + j ) );
+
+            __m256i sum, difference;
+            butterfly_avx2<MOD, IS_DIF>( _mm256_loadu_si256( u_data ),
+                                         _mm256_loadu_si256( v_data ),
+                                         w,
+                                         sum,
+                                         difference );
+            _mm256_storeu_si256( u_data, sum );
+            _mm256_storeu_si256( v_data, difference );
+        }
+    }
+
+    // AVX2 has no two-register permute: permute both and blend.
+    [[gnu::target( "avx2" )]] inline __m256i permute2_avx2(
+        __m256i first, __m256i second, __m256i lanes, __m256i from_second ) {
+        return _mm256_blendv_epi8( _mm256_permutevar8x32_epi32( first, lanes ),
+                                   _mm256_permutevar8x32_epi32( second, lanes ),
+                                   from_second );
+    }
+
+    // Butterflies of the short stages (half < 8) pair lanes of the same
+    // register: two loaded registers are regrouped so that all "upper"
+    // and all "lower" inputs share a register, then scattered back.
+    template <uint32_t MOD, bool IS_DIF>
+    [[gnu::target( "avx2" )]] void
+    ntt_small_stage_avx2( uint32_t* a,
+                          size_t n,
+                          size_t half,
+                          const uint32_t* twiddles ) {
+        alignas( 32 ) uint32_t index[4][8];
+        alignas( 32 ) uint32_t w[8];
+        fill_butterfly_inputs( index[0], index[1], 8, half );
+        fill_butterfly_outputs( index[2], index[3], 8, half );
+        for ( size_t p = 0; p < 8; ++p ) {
+            w[p] = twiddles[p % half];
+        }
+
+        __m256i lanes[4], from_second[4];
+        for ( size_t k = 0; k < 4; ++k ) {
+            __m256i value = _mm256_load_si256(
+                reinterpret_cast<const __m256i*>( index[k] ) );
+            lanes[k] = _mm256_and_si256( value, _mm256_set1_epi32( 7 ) );
+            from_second[k] =
+                _mm256_cmpgt_epi32( value, _mm256_set1_epi32( 7 ) );
+        }
+        __m256i twiddle =
+            _mm256_load_si256( reinterpret_cast<const __m256i*>( w ) );
+
+        for ( size_t i = 0; i < n; i += 16 ) {
+            __m256i* first = reinterpret_cast<__m256i*>( a + i );
+            __m256i* second = reinterpret_cast<__m256i*>( a + i + 8 );
+            __m256i x = _mm256_loadu_si256( first );
+            __m256i y = _mm256_loadu_si256( second );
+
+            __m256i sum, diff;
+            butterfly_avx2<MOD, IS_DIF>(
+                permute2_avx2( x, y, lanes[0], from_second[0] ),
+                permute2_avx2( x, y, lanes[1], from_second[1] ),
+                twiddle,
+                sum,
+                diff );
+
+            _mm256_storeu_si256(
+                first, permute2_avx2( sum, diff, lanes[2], from_second[2] ) );
+            _mm256_storeu_si256(
+                second, permute2_avx2( sum, diff, lanes[3], from_second[3] ) );
+        }
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx2" )]] void mul_vector_avx2( uint32_t* a,
+                                                    const uint32_t* b,
+                                                    size_t n,
+                                                    uint32_t factor ) {
+        const __m256i scale = _mm256_set1_epi32( factor );
+
+        for ( size_t i = 0; i < n; i += 8 ) {
+            __m256i* target = reinterpret_cast<__m256i*>( a + i );
+            __m256i value = _mm256_loadu_si256( target );
+
+            if ( b != nullptr ) {
+                value = mont_mul_avx2<MOD>(
+                    value,
+                    _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>( b + i ) ) );
+            }
+            _mm256_storeu_si256( target, mont_mul_avx2<MOD>( value, scale ) );
+        }
+    }
+
+    // GCC 12 takes the unused merge operand of the unmasked
+    // _mm512_mul_epu32(), _mm512_srli_epi64() and _mm512_min_epu32() from
+    // _mm512_undefined_epi32(), which -Wmaybe-uninitialized then reports in
+    // every caller. Their zero-masked forms with all lanes selected are the
+    // same instructions.
+    [[gnu::target( "avx512f" )]] inline __m512i
+    mul_epu32_avx512( __m512i lhs, __m512i rhs ) {
+        return _mm512_maskz_mul_epu32( 0xFF, lhs, rhs );
+    }
+
+    [[gnu::target( "avx512f" )]] inline __m512i
+    high_halves_avx512( __m512i value ) {
+        return _mm512_maskz_srli_epi64( 0xFF, value, 32 );
+    }
+
+    [[gnu::target( "avx512f" )]] inline __m512i
+    min_epu32_avx512( __m512i lhs, __m512i rhs ) {
+        return _mm512_maskz_min_epu32( 0xFFFF, lhs, rhs );
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx512f" )]] inline __m512i mont_mul_avx512( __m512i lhs,
+                                                                 __m512i rhs ) {
+        const __m512i mod = _mm512_set1_epi32( MOD );
+        const __m512i neg_inverse =
+            _mm512_set1_epi32( Montgomery<MOD>::NEG_INVERSE );
+
+        __m512i even = mul_epu32_avx512( lhs, rhs );
+        __m512i odd = mul_epu32_avx512( high_halves_avx512( lhs ),
+                                        high_halves_avx512( rhs ) );
+
+        __m512i even_factor = mul_epu32_avx512( even, neg_inverse );
+        __m512i odd_factor = mul_epu32_avx512( odd, neg_inverse );
+        even = _mm512_add_epi64( even, mul_epu32_avx512( even_factor, mod ) );
+        odd = _mm512_add_epi64( odd, mul_epu32_avx512( odd_factor, mod ) );
+
+        __m512i result = _mm512_mask_blend_epi32(
+            0xAAAA, high_halves_avx512( even ), odd );
+        return min_epu32_avx512( result, _mm512_sub_epi32( result, mod ) );
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx512f" )]] inline __m512i mont_add_avx512( __m512i lhs,
+                                                                 __m512i rhs ) {
+        __m512i sum = _mm512_add_epi32( lhs, rhs );
+        return min_epu32_avx512(
+            sum, _mm512_sub_epi32( sum, _mm512_set1_epi32( MOD ) ) );
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx512f" )]] inline __m512i mont_sub_avx512( __m512i lhs,
+                                                                 __m512i rhs ) {
+        __m512i difference = _mm512_sub_epi32( lhs, rhs );
+        return min_epu32_avx512(
+            difference,
+            _mm512_add_epi32( difference, _mm512_set1_epi32( MOD ) ) );
+    }
+
+    template <uint32_t MOD, bool IS_DIF>
+    [[gnu::target( "avx512f" )]] inline void
+    butterfly_avx512( __m512i u,
+                      __m512i v,
+                      __m512i w,
+                      __m512i& sum,
+                      __m512i& difference ) {
+        if constexpr ( !IS_DIF ) v = mont_mul_avx512<MOD>( v, w );
+        sum = mont_add_avx512<MOD>( u, v );
+        difference = mont_sub_avx512<MOD>( u, v );
+        if constexpr ( IS_DIF )
+            difference = mont_mul_avx512<MOD>( difference, w );
+    }
+
+    template <uint32_t MOD, bool IS_DIF>
+    [[gnu::target( "avx512f" )]] void
+    ntt_butterflies_avx512( uint32_t* low,
+                            uint32_t* high,
+                            size_t count,
+                            const uint32_t* twiddles ) {
+        for ( size_t j = 0; j < count; j += 16 ) {
+            __m512i sum, difference;
+            butterfly_avx512<MOD, IS_DIF>( _mm512_loadu_si512( low + j ),
+                                           _mm512_loadu_si512( high + j ),
+                                           _mm512_loadu_si512( twiddles + j ),
+                                           sum,
+                                           difference );
+            _mm512_storeu_si512( low + j, sum );
+            _mm512_storeu_si512( high + j, difference );
+        }
+    }
+
+    template <uint32_t MOD, bool IS_DIF>
+    [[gnu::target( "avx512f" )]] void
+    ntt_small_stage_avx512( uint32_t* a,
+                            size_t n,
+                            size_t half,
+                            const uint32_t* twiddles ) {
+        alignas( 64 ) uint32_t index[4][16];
+        alignas( 64 ) uint32_t w[16];
+        fill_butterfly_inputs( index[0], index[1], 16, half );
+        fill_butterfly_outputs( index[2], index[3], 16, half );
+        for ( size_t p = 0; p < 16; ++p ) {
+            w[p] = twiddles[p % half];
+        }
+
+        __m512i lower_index = _mm512_load_si512( index[0] );
+        __m512i upper_index = _mm512_load_si512( index[1] );
+        __m512i first_index = _mm512_load_si512( index[2] );
+        __m512i second_index = _mm512_load_si512( index[3] );
+        __m512i twiddle = _mm512_load_si512( w );
+
+        for ( size_t i = 0; i < n; i += 32 ) {
+            __m512i x = _mm512_loadu_si512( a + i );
+            __m512i y = _mm512_loadu_si512( a + i + 16 );
+
+            __m512i sum, difference;
+            butterfly_avx512<MOD, IS_DIF>(
+                _mm512_permutex2var_epi32( x, lower_index, y ),
+                _mm512_permutex2var_epi32( x, upper_index, y ),
+                twiddle,
+                sum,
+                difference );
+
+            _mm512_storeu_si512(
+                a + i,
+                _mm512_permutex2var_epi32( sum, first_index, difference ) );
+            _mm512_storeu_si512(
+                a + i + 16,
+                _mm512_permutex2var_epi32( sum, second_index, difference ) );
+        }
+    }
+
+    template <uint32_t MOD>
+    [[gnu::target( "avx512f" )]] void mul_vector_avx512( uint32_t* a,
+                                                         const uint32_t* b,
+                                                         size_t n,
+                                                         uint32_t factor ) {
+        const __m512i scale = _mm512_set1_epi32( factor );
+
+        for ( size_t i = 0; i < n; i += 16 ) {
+            __m512i value = _mm512_loadu_si512( a + i );
+
+            if ( b != nullptr ) {
+                value = mont_mul_avx512<MOD>( value,
+                                              _mm512_loadu_si512( b + i ) );
+            }
+            _mm512_storeu_si512( a + i, mont_mul_avx512<MOD>( value, scale ) );
+        }
+    }
+#endif
+}
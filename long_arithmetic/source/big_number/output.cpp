@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 #include "big_number.hpp"
@@ -6,68 +10,147 @@
 #include "getters.hpp"
 
 namespace big_number {
+    // A chunk is formatted as two halves of this many digits, so each half
+    // fits 32-bit arithmetic.
+    constexpr uint32_t HALF_CHUNK_DIGITS = BASE / 2;
+    constexpr uint32_t HALF_CHUNK_BASE = 1000000000;
+
+    static_assert( BASE == 2 * HALF_CHUNK_DIGITS,
+                   "chunk formatting assumes two 9-digit halves" );
+
+    // "00", "01", ..., "99" back to back.
+    constexpr std::array<char, 200> DIGIT_PAIRS = [] {
+        std::array<char, 200> pairs{};
+        for ( size_t value = 0; value < 100; ++value ) {
+            pairs[2 * value] = static_cast<char>( ZERO_CHAR + value / 10 );
+            pairs[2 * value + 1] = static_cast<char>( ZERO_CHAR + value % 10 );
+        }
+        return pairs;
+    }();
+
+    // Longest exponent suffix: "e", the sign string and a signed int32_t.
+    constexpr size_t MAX_EXPONENT_LENGTH = 16;
+
     int32_t compute_exponent( const BigNumber& number ) {
         return get_shift( number ) * BASE;
     }
 
-    std::string get_sign_string( bool is_negative ) {
-        return is_negative ? MINUS_STR : EMPTY_STR;
+    // Writes the nine digits of value, zero padded, ending at out.
+    inline void write_half_chunk( char* out, uint32_t value ) {
+        for ( uint32_t pair = 0; pair < HALF_CHUNK_DIGITS / 2; ++pair ) {
+            out -= 2;
+            std::memcpy( out, &DIGIT_PAIRS[2 * ( value % 100 )], 2 );
+            value /= 100;
+        }
+        *--out = static_cast<char>( ZERO_CHAR + value );
+    }
+
+    inline void write_chunk( char* out, chunk value ) {
+        write_half_chunk( out + BASE,
+                          static_cast<uint32_t>( value % HALF_CHUNK_BASE ) );
+        write_half_chunk( out + HALF_CHUNK_DIGITS,
+                          static_cast<uint32_t>( value / HALF_CHUNK_BASE ) );
     }
 
-    std::string get_exponent_string( const BigNumber& number ) {
+    size_t count_chunk_digits( chunk value ) {
+        size_t count = ONE_INT;
+        for ( ; value >= 10; value /= 10 ) {
+            ++count;
+        }
+        return count;
+    }
+
+    // Writes the exponent suffix into buffer and returns its length.
+    size_t write_exponent( const BigNumber& number, char* buffer ) {
         int32_t exponent = compute_exponent( number );
-        if ( exponent == ZERO_INT ) return EMPTY_STR;
+        if ( exponent == ZERO_INT ) return ZERO_INT;
 
-        return EXP_STR + get_sign_string( exponent < ZERO_INT ) +
-               std::to_string( exponent );
+        char* out = buffer;
+        out = std::copy( EXP_STR.begin(), EXP_STR.end(), out );
+        if ( exponent < ZERO_INT ) {
+            out = std::copy( MINUS_STR.begin(), MINUS_STR.end(), out );
+        }
+        out = std::to_chars( out, buffer + MAX_EXPONENT_LENGTH, exponent ).ptr;
+        return out - buffer;
     }
 
-    std::string format_chunk( chunk value, bool is_first ) {
-        std::string str = std::to_string( value );
-        if ( is_first ) return str;
+    const std::string& get_special_body( const BigNumber& number ) {
+        switch ( get_type( number ) ) {
+        case BigNumberType::NOT_A_NUMBER:
+            return NAN_STR;
+        case BigNumberType::INF:
+            return INF_STR;
+        case BigNumberType::ZERO:
+            return ZERO_STR;
+        default:
+            return EMPTY_STR;
+        }
+    }
 
-        str.insert( str.begin(), BASE - str.length(), ZERO_CHAR );
-        return str;
+    size_t get_sign_length( const BigNumber& number ) {
+        return is_negative( number ) ? MINUS_STR.size() : ZERO_INT;
     }
 
-    std::string get_mantissa_string( const BigNumber& number ) {
+    size_t count_digits_length( const BigNumber& number ) {
         size_t size = get_size( number );
-        if ( size == ZERO_INT ) return EMPTY_STR;
+        if ( size == ZERO_INT ) return ZERO_INT;
 
-        const chunks& mantissa = get_mantissa( number );
-        size_t first_chunk_idx = size - ONE_INT;
-        std::string str;
+        return count_chunk_digits( get_chunk( number, size - ONE_INT ) ) +
+               ( size - ONE_INT ) * BASE;
+    }
 
-        str.reserve( size * BASE );
+    // Writes the digits of the mantissa, most significant chunk first.
+    char* write_digits( char* out, const BigNumber& number ) {
+        size_t size = get_size( number );
+        if ( size == ZERO_INT ) return out;
 
+        const chunks& mantissa = get_mantissa( number );
+        out = std::to_chars( out, out + BASE, mantissa[size - ONE_INT] ).ptr;
         for ( size_t index = size - ONE_INT; index > ZERO_INT; --index ) {
-            str += format_chunk( mantissa[index], first_chunk_idx == index );
+            write_chunk( out, mantissa[index - ONE_INT] );
+            out += BASE;
         }
-        str += format_chunk( mantissa[0], 0 == first_chunk_idx );
-
-        return str;
+        return out;
     }
 
-    std::string get_special_string( const BigNumber& number ) {
-        switch ( get_type( number ) ) {
-        case BigNumberType::NOT_A_NUMBER:
-            return get_sign_string( is_negative( number ) ) + NAN_STR;
-        case BigNumberType::INF:
-            return get_sign_string( is_negative( number ) ) + INF_STR;
-        case BigNumberType::ZERO:
-            return get_sign_string( is_negative( number ) ) + ZERO_STR;
-        default:
-            return EMPTY_STR;
+    // Writes the full representation; out has room for formatted_length().
+    char* write_formatted( char* out, const BigNumber& number ) {
+        out = std::copy_n( MINUS_STR.begin(), get_sign_length( number ), out );
+        if ( is_special( number ) ) {
+            const std::string& body = get_special_body( number );
+            return std::copy( body.begin(), body.end(), out );
         }
+
+        out = write_digits( out, number );
+        char exponent[MAX_EXPONENT_LENGTH];
+        size_t exponent_length = write_exponent( number, exponent );
+        return std::copy_n( exponent, exponent_length, out );
     }
 
-    std::string to_string( const BigNumber& number ) {
-        if ( is_special( number ) ) return get_special_string( number );
+    size_t formatted_length( const BigNumber& number ) {
+        if ( is_special( number ) )
+            return get_sign_length( number ) +
+                   get_special_body( number ).size();
+
+        char exponent[MAX_EXPONENT_LENGTH];
+        return get_sign_length( number ) + count_digits_length( number ) +
+               write_exponent( number, exponent );
+    }
 
-        std::string sign = get_sign_string( is_negative( number ) );
-        std::string mantissa = get_mantissa_string( number );
-        std::string exponent = get_exponent_string( number );
+    std::to_chars_result
+    to_chars( char* first, char* last, const BigNumber& number ) {
+        size_t length = formatted_length( number );
+        if ( static_cast<size_t>( last - first ) < length )
+            return { last, std::errc::value_too_large };
 
-        return sign + mantissa + exponent;
+        return { write_formatted( first, number ), std::errc{} };
+    }
+
+    // The length is known up front, so the digits go straight into the one
+    // allocation of the result.
+    std::string to_string( const BigNumber& number ) {
+        std::string str( formatted_length( number ), ZERO_CHAR );
+        write_formatted( str.data(), number );
+        return str;
     }
 }
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "getters.hpp"
+#include "serialization.hpp"
+
+namespace big_number {
+    // Version 1 of the wire format, all fields little-endian:
+    //   bytes 0-3    magic "BNUM"
+    //   byte 4       version
+    //   byte 5       BigNumberType
+    //   byte 6       sign, 1 for negative
+    //   byte 7       ErrorCode
+    //   bytes 8-11   shift, int32_t
+    //   bytes 12-15  chunk count, uint32_t
+    //   bytes 16-    the chunks, least significant first
+    // The header keeps the chunks 8-byte aligned relative to its start.
+    constexpr std::byte SERIAL_MAGIC[] = { std::byte{ 'B' },
+                                           std::byte{ 'N' },
+                                           std::byte{ 'U' },
+                                           std::byte{ 'M' } };
+    constexpr uint8_t SERIAL_VERSION = 1;
+    constexpr size_t SERIAL_HEADER_SIZE = 16;
+
+    constexpr bool IS_LITTLE_ENDIAN =
+        std::endian::native == std::endian::little;
+
+    void store_bytes( std::byte* out, uint64_t value, size_t count ) {
+        for ( size_t i = 0; i < count; ++i ) {
+            out[i] = static_cast<std::byte>( value >> ( 8 * i ) );
+        }
+    }
+
+    uint64_t load_bytes( const std::byte* in, size_t count ) {
+        uint64_t value = ZERO_INT;
+        for ( size_t i = 0; i < count; ++i ) {
+            value |= static_cast<uint64_t>( in[i] ) << ( 8 * i );
+        }
+        return value;
+    }
+
+    size_t serialized_size( const BigNumberView& number ) {
+        return SERIAL_HEADER_SIZE + get_size( number ) * sizeof( chunk );
+    }
+
+    size_t serialized_size( const BigNumber& number ) {
+        return serialized_size( make_view( number ) );
+    }
+
+    bool is_valid_header( BigNumberType type,
+                          uint8_t sign,
+                          uint8_t error_code,
+                          int32_t shift,
+                          uint32_t count ) {
+        if ( sign > ONE_INT ) return false;
+        if ( error_code > static_cast<uint8_t>( ErrorCode::ERROR ) )
+            return false;
+
+        switch ( type ) {
+        case BigNumberType::DEFAULT:
+            return count >= MIN_CHUNKS && count <= MAX_CHUNKS &&
+                   shift >= -MAX_SHIFT && shift <= MAX_SHIFT;
+        case BigNumberType::ZERO:
+        case BigNumberType::INF:
+        case BigNumberType::NOT_A_NUMBER:
+            return count == ZERO_INT;
+        default:
+            return false;
+        }
+    }
+
+    // Every chunk is a base 10^18 digit, and the mantissa is trimmed on both
+    // ends, checked in one pass.
+    bool is_valid_mantissa( std::span<const chunk> mantissa ) {
+        if ( mantissa.empty() ) return true;
+        if ( mantissa.front() == ZERO_INT || mantissa.back() == ZERO_INT )
+            return false;
+
+        return std::ranges::all_of(
+            mantissa, []( chunk value ) { return value < MAX_CHUNK; } );
+    }
+
+    bool is_serializable( const BigNumberView& number ) {
+        auto error_code =
+            static_cast<uint8_t>( get_error_code( get_error( number ) ) );
+        return get_size( number ) <= MAX_CHUNKS &&
+               is_valid_header( get_type( number ),
+                                is_negative( number ),
+                                error_code,
+                                get_shift( number ),
+                                static_cast<uint32_t>( get_size( number ) ) ) &&
+               is_valid_mantissa( get_mantissa( number ) );
+    }
+
+    size_t serialize( const BigNumberView& number,
+                      std::span<std::byte> buffer ) {
+        size_t size = serialized_size( number );
+        if ( buffer.size() < size || !is_serializable( number ) )
+            return ZERO_INT;
+
+        std::byte* out = buffer.data();
+        std::memcpy( out, SERIAL_MAGIC, sizeof( SERIAL_MAGIC ) );
+        store_bytes( out + 4, SERIAL_VERSION, 1 );
+        store_bytes( out + 5, static_cast<uint8_t>( get_type( number ) ), 1 );
+        store_bytes( out + 6, is_negative( number ), 1 );
+        store_bytes(
+            out + 7,
+            static_cast<uint8_t>( get_error_code( get_error( number ) ) ),
+            1 );
+        store_bytes( out + 8, static_cast<uint32_t>( get_shift( number ) ), 4 );
+        store_bytes( out + 12, get_size( number ), 4 );
+
+        std::span<const chunk> mantissa = get_mantissa( number );
+        std::byte* chunks_out = out + SERIAL_HEADER_SIZE;
+        if constexpr ( IS_LITTLE_ENDIAN ) {
+            std::memcpy(
+                chunks_out, mantissa.data(), mantissa.size_bytes() );
+        } else {
+            for ( size_t i = 0; i < mantissa.size(); ++i ) {
+                store_bytes( chunks_out + i * sizeof( chunk ),
+                             mantissa[i],
+                             sizeof( chunk ) );
+            }
+        }
+        return size;
+    }
+
+    size_t serialize( const BigNumber& number, std::span<std::byte> buffer ) {
+        return serialize( make_view( number ), buffer );
+    }
+
+    // The view points into buffer, so the chunks have to be aligned there.
+    size_t deserialize( std::span<const std::byte> buffer,
+                        BigNumberView& number ) {
+        if constexpr ( !IS_LITTLE_ENDIAN ) return ZERO_INT;
+
+        if ( buffer.size() < SERIAL_HEADER_SIZE ) return ZERO_INT;
+
+        const std::byte* in = buffer.data();
+        if ( std::memcmp( in, SERIAL_MAGIC, sizeof( SERIAL_MAGIC ) ) != 0 ||
+             load_bytes( in + 4, 1 ) != SERIAL_VERSION )
+            return ZERO_INT;
+
+        auto type = static_cast<BigNumberType>( load_bytes( in + 5, 1 ) );
+        auto sign = static_cast<uint8_t>( load_bytes( in + 6, 1 ) );
+        auto error_code = static_cast<uint8_t>( load_bytes( in + 7, 1 ) );
+        auto shift = static_cast<int32_t>( load_bytes( in + 8, 4 ) );
+        auto count = static_cast<uint32_t>( load_bytes( in + 12, 4 ) );
+        if ( !is_valid_header( type, sign, error_code, shift, count ) )
+            return ZERO_INT;
+
+        size_t size = SERIAL_HEADER_SIZE + count * sizeof( chunk );
+        const std::byte* chunks_in = in + SERIAL_HEADER_SIZE;
+        if ( buffer.size() < size ||
+             reinterpret_cast<uintptr_t>( chunks_in ) % alignof( chunk ) !=
+                 ZERO_INT )
+            return ZERO_INT;
+
+        std::span<const chunk> mantissa(
+            reinterpret_cast<const chunk*>( chunks_in ), count );
+        if ( !is_valid_mantissa( mantissa ) ) return ZERO_INT;
+
+        number = { mantissa,
+                   shift,
+                   type,
+                   make_error( static_cast<ErrorCode>( error_code ) ),
+                   sign == ONE_INT };
+        return size;
+    }
+}
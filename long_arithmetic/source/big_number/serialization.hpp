@@ -0,0 +1,9 @@
+#pragma once
+
+#include "big_number.hpp"
+
+namespace big_number {
+    // Whether number is in the canonical form deserialize() accepts;
+    // serialize() writes nothing for any other value.
+    bool is_serializable( const BigNumberView& number );
+}
@@ -0,0 +1,122 @@
+#include "series.hpp"
+
+#include <memory>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "mul.hpp"
+#include "natural.hpp"
+#include "worker_pool.hpp"
+
+namespace big_number {
+    chunks to_chunks( mul_chunk value ) {
+        chunks result;
+        while ( value != ZERO_INT ) {
+            result.push_back( static_cast<chunk>( value % MAX_CHUNK ) );
+            value /= MAX_CHUNK;
+        }
+        return result;
+    }
+
+    // Goes through multiply_into(), so the products near the root of the
+    // splitting tree take the NTT path like mul() does.
+    chunks multiply_chunks( chunks_view lhs, chunks_view rhs ) {
+        if ( lhs.empty() || rhs.empty() ) return {};
+
+        chunks product( lhs.size() + rhs.size() );
+        multiply_into( lhs, rhs, product );
+        product.resize( trim_chunks( product ).size() );
+        return product;
+    }
+
+    // Adds two signed magnitudes into the first one.
+    void add_signed( chunks& target,
+                     bool& is_negative,
+                     const chunks& value,
+                     bool is_value_negative ) {
+        if ( is_negative == is_value_negative ) {
+            target = add_chunks( target, value );
+        } else if ( compare_chunks( target, value ) >= 0 ) {
+            target = sub_chunks( target, value );
+        } else {
+            target = sub_chunks( value, target );
+            is_negative = is_value_negative;
+        }
+
+        if ( target.empty() ) is_negative = false;
+    }
+
+    SeriesSplit
+    split_term( const SeriesTerms& terms, uint64_t index, bool has_b ) {
+        SeriesTerm term = terms( index );
+        SeriesSplit split;
+
+        split.p = to_chunks( term.p );
+        split.q = to_chunks( term.q );
+        if ( has_b ) split.b = to_chunks( term.b );
+        split.t = multiply_chunks( to_chunks( term.a ), split.p );
+        split.is_p_negative = term.is_negative;
+        split.is_t_negative = term.is_negative && !split.t.empty();
+        return split;
+    }
+
+    // T = b( right ) q( right ) t( left ) + b( left ) p( left ) t( right ),
+    // while p, q and b multiply.
+    SeriesSplit merge_splits( const SeriesSplit& left,
+                              const SeriesSplit& right,
+                              bool has_p,
+                              bool has_b ) {
+        SeriesSplit split;
+
+        chunks left_factor =
+            has_b ? multiply_chunks( right.b, right.q ) : right.q;
+        chunks right_factor =
+            has_b ? multiply_chunks( left.b, left.p ) : left.p;
+        split.t = multiply_chunks( left_factor, left.t );
+        split.is_t_negative = left.is_t_negative;
+        add_signed( split.t,
+                    split.is_t_negative,
+                    multiply_chunks( right_factor, right.t ),
+                    left.is_p_negative != right.is_t_negative );
+
+        split.q = multiply_chunks( left.q, right.q );
+        if ( has_b ) split.b = multiply_chunks( left.b, right.b );
+        if ( has_p ) split.p = multiply_chunks( left.p, right.p );
+        split.is_p_negative = left.is_p_negative != right.is_p_negative;
+        return split;
+    }
+
+    // The halves of a long range are independent, so they go to separate
+    // threads; the products of the merge spread over the pool on their own.
+    SeriesSplit split_range( const SeriesTerms& terms,
+                             uint64_t first,
+                             uint64_t last,
+                             bool has_p,
+                             bool has_b,
+                             WorkerPool* pool ) {
+        if ( last - first == ONE_INT ) return split_term( terms, first, has_b );
+
+        uint64_t middle = first + ( last - first ) / 2;
+        SeriesSplit halves[2];
+        auto split_half = [&]( size_t half ) {
+            if ( half == ZERO_INT ) {
+                halves[half] =
+                    split_range( terms, first, middle, true, has_b, pool );
+            } else {
+                halves[half] =
+                    split_range( terms, middle, last, has_p, has_b, pool );
+            }
+        };
+        run_parallel( last - first >= SERIES_PARALLEL_TERMS ? pool : nullptr,
+                      2,
+                      split_half );
+
+        return merge_splits( halves[0], halves[1], has_p, has_b );
+    }
+
+    SeriesSplit
+    split_series( const SeriesTerms& terms, uint64_t count, bool has_b ) {
+        std::shared_ptr<WorkerPool> pool = get_mul_pool();
+        return split_range( terms, 0, count, false, has_b, pool.get() );
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "big_number.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    // Smallest range of terms whose halves are split on different threads
+    // of the multiplication pool.
+    constexpr uint64_t SERIES_PARALLEL_TERMS = 512;
+
+    // Term k of a hypergeometric series is a( k ) / b( k ) times the
+    // product of p( j ) / q( j ) for j <= k, where p( 0 ) = q( 0 ) = 1.
+    // The sign of the term ratio goes with p( k ).
+    struct SeriesTerm {
+        mul_chunk p;
+        mul_chunk q;
+        mul_chunk a;
+        mul_chunk b;
+        bool is_negative;
+    };
+
+    using SeriesTerms = std::function<SeriesTerm( uint64_t index )>;
+
+    // Binary splitting state of a range of terms: their sum is
+    // t / ( b * q ) relative to the terms before the range, and p / q is the
+    // ratio the range passes on. b stays empty for series without
+    // denominators, and p for ranges that end the series.
+    struct SeriesSplit {
+        chunks p;
+        chunks q;
+        chunks b;
+        chunks t;
+        bool is_p_negative;
+        bool is_t_negative;
+    };
+
+    chunks to_chunks( mul_chunk value );
+
+    chunks multiply_chunks( chunks_view lhs, chunks_view rhs );
+
+    // Sums terms 0, ..., count - 1 into t / ( b * q ).
+    SeriesSplit
+    split_series( const SeriesTerms& terms, uint64_t count, bool has_b );
+}
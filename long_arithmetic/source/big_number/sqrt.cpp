@@ -0,0 +1,385 @@
+#include "sqrt.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "constructors.hpp"
+#include "div.hpp"
+#include "getters.hpp"
+#include "mul.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    constexpr std::array<chunk, 1> UNIT = { ONE_INT };
+
+    // The estimates with one extra chunk are off by far less than this many
+    // units of that chunk.
+    constexpr chunk FRACTION_GUARD = 1000000000;
+
+    // floor( sqrt( value ) ) for value below MAX_CHUNK^2. The first Newton
+    // step from the floating point estimate lands at or above the root, and
+    // the following ones decrease to it.
+    chunk sqrt_mul_chunk( mul_chunk value ) {
+        auto estimate = static_cast<chunk>(
+            std::sqrt( static_cast<double>( value ) ) );
+        mul_chunk root = std::max<chunk>( estimate, ONE_INT );
+        root = ( root + value / root ) / 2;
+
+        while ( true ) {
+            mul_chunk next = ( root + value / root ) / 2;
+            if ( next >= root ) return static_cast<chunk>( root );
+            root = next;
+        }
+    }
+
+    // value < ( lead + 1 ) * MAX_CHUNK^( 2 * low ) for the one or two top
+    // chunks in lead, and ( floor( sqrt( lead ) ) + 1 )^2 > lead.
+    chunks sqrt_upper_bound( chunks_view value ) {
+        size_t size = value.size();
+        size_t low = ( size - ONE_INT ) / 2;
+        mul_chunk lead = value[size - ONE_INT];
+        if ( size % 2 == 0 ) lead = lead * MAX_CHUNK + value[size - 2];
+
+        chunk root = sqrt_mul_chunk( lead ) + ONE_INT;
+        chunks bound( low, ZERO_INT );
+        bound.push_back( root % MAX_CHUNK );
+        if ( root >= MAX_CHUNK ) bound.push_back( root / MAX_CHUNK );
+        return bound;
+    }
+
+    // Integer Newton steps x = ( x + value / x ) / 2 decrease from any
+    // bound above the root and stop at floor( sqrt( value ) ).
+    chunks small_sqrt_chunks( chunks_view value ) {
+        chunks root = sqrt_upper_bound( value );
+
+        while ( true ) {
+            chunks next =
+                add_chunks( root, divide_chunks( value, root ).quotient );
+            div_chunks_small( next, 2 );
+            next.resize( trim_chunks( next ).size() );
+
+            if ( compare_chunks( next, root ) >= 0 ) return root;
+            root = std::move( next );
+        }
+    }
+
+    // Newton's iteration x += x * ( 1 - value * x^2 ) / 2 doubles the
+    // number of correct chunks, so the root of the top half of the value is
+    // refined with one product at full length and two at half length.
+    chunks
+    approximate_rsqrt_chunks( chunks_view value, size_t size, size_t extra ) {
+        if ( size < SQRT_NEWTON_THRESHOLD ) {
+            chunks power( 4 * size + 2 * extra + ONE_INT, ZERO_INT );
+            power.back() = ONE_INT;
+            return small_sqrt_chunks( divide_chunks( power, value ).quotient );
+        }
+
+        size_t half = size / 2 + ONE_INT;
+        chunks head = approximate_rsqrt_chunks(
+            value.subspan( 2 * ( size - half ) ), half, ZERO_INT );
+        chunks square( 2 * head.size() );
+        square_into( head, square );
+        chunks_view head_square = trim_chunks( square );
+
+        // The error of the head against MAX_CHUNK^( 2 size + 2 half ). Value
+        // chunks below size - extra - 4 and the low 2 half + 3 chunks of the
+        // error are below the precision of the update.
+        size_t cut = size - extra - 4;
+        size_t power = 2 * size + 2 * half - cut;
+        chunks_view top = value.subspan( cut );
+        chunks error( std::max( top.size() + head_square.size(),
+                                power + ONE_INT ),
+                      ZERO_INT );
+        multiply_into(
+            top,
+            head_square,
+            chunks_span( error ).first( top.size() + head_square.size() ) );
+
+        bool is_excess =
+            compare_chunks( chunks_view( error ).subspan( power ), UNIT ) >= 0;
+        if ( is_excess ) {
+            sub_chunks_into( chunks_span( error ).subspan( power ), UNIT );
+        } else {
+            chunks full( power + ONE_INT, ZERO_INT );
+            full.back() = ONE_INT;
+            sub_chunks_into( full, trim_chunks( error ) );
+            error = std::move( full );
+        }
+
+        chunks_view error_head =
+            trim_chunks( chunks_view( error ).subspan( 2 * half + 3 ) );
+        chunks update( head.size() + error_head.size() );
+        multiply_into( head, error_head, update );
+        chunks correction(
+            update.begin() + std::min( half + ONE_INT, update.size() ),
+            update.end() );
+        div_chunks_small( correction, 2 );
+
+        chunks root( size + extra + 3, ZERO_INT );
+        std::ranges::copy( head, root.begin() + ( size - half + extra ) );
+        if ( is_excess ) {
+            sub_chunks_into( root, trim_chunks( correction ) );
+            sub_chunks_into( root, UNIT );
+        } else {
+            add_chunks_into( root, trim_chunks( correction ) );
+        }
+
+        root.resize( trim_chunks( root ).size() );
+        return root;
+    }
+
+    // Splits an estimate with one extra chunk into its integer part, which
+    // gets a spare top chunk, and reports whether the fraction is far enough
+    // from a chunk boundary to fix the floor.
+    bool split_fraction( chunks& estimate ) {
+        estimate.push_back( ZERO_INT );
+        chunk fraction = estimate.front();
+        estimate.erase( estimate.begin() );
+        return fraction >= FRACTION_GUARD &&
+               fraction < MAX_CHUNK - FRACTION_GUARD;
+    }
+
+    // Steps an estimate a few units away from floor( sqrt( value ) ) onto
+    // it with the differences of consecutive squares. The root has a spare
+    // top chunk.
+    void correct_root( chunks_view value, chunks& root ) {
+        chunks_view trimmed = trim_chunks( root );
+        chunks square( 2 * trimmed.size() );
+        square_into( trimmed, square );
+
+        while ( compare_chunks( square, value ) > 0 ) {
+            sub_chunks_into( square, root );
+            sub_chunks_into( square, root );
+            add_chunks_into( square, UNIT );
+            sub_chunks_into( root, UNIT );
+        }
+
+        chunks rest = sub_chunks( value, square );
+        chunks step = add_chunks( root, root );
+        step.push_back( ZERO_INT );
+        add_chunks_into( step, UNIT );
+
+        while ( compare_chunks( rest, step ) >= 0 ) {
+            sub_chunks_into( rest, trim_chunks( step ) );
+            add_chunks_into( root, UNIT );
+            add_chunks_into( step, UNIT );
+            add_chunks_into( step, UNIT );
+        }
+    }
+
+    // The same for floor( MAX_CHUNK^( 2n ) / sqrt( value ) ), keeping
+    // root^2 * value and root * value so that each step is a few additions.
+    void correct_reciprocal_root( chunks_view value,
+                                  size_t size,
+                                  chunks& root ) {
+        chunks_view trimmed = trim_chunks( root );
+        chunks product( trimmed.size() + value.size() + ONE_INT, ZERO_INT );
+        multiply_into(
+            trimmed,
+            value,
+            chunks_span( product ).first( trimmed.size() + value.size() ) );
+        chunks_view product_head = trim_chunks( product );
+        chunks square( trimmed.size() + product_head.size() + ONE_INT,
+                       ZERO_INT );
+        multiply_into( trimmed,
+                       product_head,
+                       chunks_span( square ).first( trimmed.size() +
+                                                    product_head.size() ) );
+        chunks power( 4 * size + ONE_INT, ZERO_INT );
+        power.back() = ONE_INT;
+
+        while ( compare_chunks( square, power ) > 0 ) {
+            sub_chunks_into( square, trim_chunks( product ) );
+            sub_chunks_into( square, trim_chunks( product ) );
+            add_chunks_into( square, value );
+            sub_chunks_into( product, value );
+            sub_chunks_into( root, UNIT );
+        }
+
+        while ( true ) {
+            chunks next( square );
+            next.resize( std::max( next.size(), power.size() ), ZERO_INT );
+            add_chunks_into( next, trim_chunks( product ) );
+            add_chunks_into( next, trim_chunks( product ) );
+            add_chunks_into( next, value );
+            if ( compare_chunks( next, power ) > 0 ) break;
+
+            square = std::move( next );
+            add_chunks_into( product, value );
+            add_chunks_into( root, UNIT );
+        }
+    }
+
+    // With y about MAX_CHUNK^( 2h ) / sqrt( head ) for the top 2h chunks of
+    // the value, s = head * y / MAX_CHUNK^( 2h ) holds the top h chunks of
+    // the root and s + y * ( head - s^2 ) / ( 2 MAX_CHUNK^( 2h ) ) the rest,
+    // so the last step needs no product at full length. Taking 2h >= n + 2
+    // keeps the value chunks below the head out of the extra chunk.
+    chunks sqrt_chunks( chunks_view value ) {
+        value = trim_chunks( value );
+        if ( value.empty() ) return {};
+
+        size_t size = ( value.size() + ONE_INT ) / 2;
+        if ( size < SQRT_NEWTON_THRESHOLD ) return small_sqrt_chunks( value );
+
+        size_t half = ( size + 3 ) / 2;
+        chunks_view head = value.subspan( 2 * ( size - half ) );
+        chunks reciprocal = approximate_rsqrt_chunks( head, half, ZERO_INT );
+
+        size_t cut = head.size() - half - 2;
+        chunks_view top = head.subspan( cut );
+        chunks product( top.size() + reciprocal.size() );
+        multiply_into( top, reciprocal, product );
+        chunks_view head_root =
+            trim_chunks( chunks_view( product ).subspan( 2 * half - cut ) );
+
+        chunks square( 2 * head_root.size() );
+        square_into( head_root, square );
+        bool is_excess = compare_chunks( square, head ) > 0;
+        chunks residual = is_excess ? sub_chunks( square, head )
+                                    : sub_chunks( head, square );
+
+        // The root with one extra chunk: the head root moves up by
+        // size - half + 1 chunks and the update down by 3 half - size - 1.
+        chunks root( size + 3, ZERO_INT );
+        std::ranges::copy( head_root,
+                           root.begin() + ( size - half + ONE_INT ) );
+        if ( !residual.empty() ) {
+            chunks update( reciprocal.size() + residual.size() );
+            multiply_into( reciprocal, residual, update );
+            chunks correction( update.begin() +
+                                   std::min( 3 * half - size - ONE_INT,
+                                             update.size() ),
+                               update.end() );
+            div_chunks_small( correction, 2 );
+
+            if ( is_excess ) {
+                sub_chunks_into( root, trim_chunks( correction ) );
+            } else {
+                add_chunks_into( root, trim_chunks( correction ) );
+            }
+        }
+
+        if ( !split_fraction( root ) ) correct_root( value, root );
+        root.resize( trim_chunks( root ).size() );
+        return root;
+    }
+
+    chunks rsqrt_chunks( chunks_view value, size_t size ) {
+        value = trim_chunks( value );
+        chunks root = approximate_rsqrt_chunks( value, size, ONE_INT );
+
+        if ( !split_fraction( root ) )
+            correct_reciprocal_root( value, size, root );
+        root.resize( trim_chunks( root ).size() );
+        return root;
+    }
+
+    // Pads the mantissa with zero chunks to 2 * MAX_CHUNKS chunks, or one
+    // less so that the exponent of the radicand stays even.
+    chunks pad_radicand( const BigNumber& number, int32_t padding ) {
+        const chunks& mantissa = get_mantissa( number );
+        if ( ( get_shift( number ) - padding ) % 2 != 0 ) --padding;
+
+        chunks radicand;
+        radicand.reserve( padding + mantissa.size() );
+        radicand.resize( padding, ZERO_INT );
+        radicand.insert( radicand.end(), mantissa.begin(), mantissa.end() );
+        return radicand;
+    }
+
+    // The root gets MAX_CHUNKS chunks without reaching below -MAX_SHIFT, so
+    // the padding stops at 2 * MAX_SHIFT above the shift. Padding the
+    // radicand does not change the truncated root.
+    BigNumber square_root( const BigNumber& number ) {
+        int32_t shift = get_shift( number );
+        int32_t padding = static_cast<int32_t>( 2 * MAX_CHUNKS ) -
+                          static_cast<int32_t>( get_size( number ) );
+        padding = std::min( padding, shift + 2 * MAX_SHIFT );
+
+        chunks radicand = pad_radicand( number, padding );
+        int32_t root_shift =
+            ( shift - static_cast<int32_t>( radicand.size() ) +
+              static_cast<int32_t>( get_size( number ) ) ) /
+            2;
+
+        return make_big_number( sqrt_chunks( radicand ),
+                                root_shift,
+                                BigNumberType::DEFAULT,
+                                get_error( number ),
+                                false );
+    }
+
+    // 1 / sqrt( radicand * MAX_CHUNK^e ) is the root of rsqrt_chunks()
+    // times MAX_CHUNK^( -2n - e / 2 ); its low chunks past MAX_CHUNKS or
+    // below -MAX_SHIFT are dropped.
+    BigNumber reciprocal_square_root( const BigNumber& number ) {
+        int32_t size = static_cast<int32_t>( MAX_CHUNKS );
+        chunks radicand = pad_radicand(
+            number, 2 * size - static_cast<int32_t>( get_size( number ) ) );
+        int32_t exponent = get_shift( number ) -
+                           static_cast<int32_t>( radicand.size() ) +
+                           static_cast<int32_t>( get_size( number ) );
+
+        chunks root = rsqrt_chunks( radicand, MAX_CHUNKS );
+        int32_t root_shift = -2 * size - exponent / 2;
+        int32_t excess = std::max(
+            static_cast<int32_t>( root.size() ) - size,
+            -MAX_SHIFT - root_shift );
+        if ( excess >= static_cast<int32_t>( root.size() ) )
+            return make_zero( get_error( number ) );
+
+        excess = std::max( excess, 0 );
+        root.erase( root.begin(), root.begin() + excess );
+        return make_big_number( std::move( root ),
+                                root_shift + excess,
+                                BigNumberType::DEFAULT,
+                                get_error( number ),
+                                false );
+    }
+
+    BigNumber sqrt_special( const BigNumber& number ) {
+        const Error& error = get_error( number );
+
+        switch ( get_type( number ) ) {
+        case BigNumberType::ZERO:
+            return make_zero( error );
+        case BigNumberType::INF:
+            if ( is_negative( number ) ) return make_nan( error );
+            return make_inf( error, false );
+        default:
+            return make_nan( error );
+        }
+    }
+
+    BigNumber rsqrt_special( const BigNumber& number ) {
+        const Error& error = get_error( number );
+
+        switch ( get_type( number ) ) {
+        case BigNumberType::ZERO:
+            return make_inf( error, false );
+        case BigNumberType::INF:
+            if ( is_negative( number ) ) return make_nan( error );
+            return make_zero( error );
+        default:
+            return make_nan( error );
+        }
+    }
+
+    BigNumber sqrt( const BigNumber& number ) {
+        if ( is_special( number ) || is_negative( number ) )
+            return sqrt_special( number );
+
+        return square_root( number );
+    }
+
+    BigNumber rsqrt( const BigNumber& number ) {
+        if ( is_special( number ) || is_negative( number ) )
+            return rsqrt_special( number );
+
+        return reciprocal_square_root( number );
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "big_number.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    // Smallest root size (in chunks) at which the Newton reciprocal square
+    // root beats integer Newton steps built on division, see the Sqrt
+    // benchmarks.
+    constexpr size_t SQRT_NEWTON_THRESHOLD = 8;
+
+    // floor( sqrt( value ) ).
+    chunks sqrt_chunks( chunks_view value );
+
+    // floor( MAX_CHUNK^( 2n ) / sqrt( value ) ) for a value of 2n - 1 or 2n
+    // chunks.
+    chunks rsqrt_chunks( chunks_view value, size_t size );
+
+    // The same root times MAX_CHUNK^extra, a few units off.
+    chunks
+    approximate_rsqrt_chunks( chunks_view value, size_t size, size_t extra );
+}
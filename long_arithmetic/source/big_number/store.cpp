@@ -0,0 +1,201 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "constructors.hpp"
+#include "serialization.hpp"
+
+namespace big_number {
+    // Store file, all fields little-endian:
+    //   bytes 0-3    magic "BNST"
+    //   bytes 4-7    version, uint32_t
+    //   bytes 8-15   value count n, uint64_t
+    //   then n + 1   uint64_t file offsets; value i spans
+    //                [offset( i ), offset( i + 1 ) )
+    //   then the values, each in the serialize() layout
+    // Every offset is a multiple of 8, so the chunks of a mapped value are
+    // aligned in place.
+    constexpr char STORE_MAGIC[] = { 'B', 'N', 'S', 'T' };
+    constexpr uint32_t STORE_VERSION = 1;
+    constexpr size_t STORE_HEADER_SIZE = 16;
+    constexpr size_t STORE_ALIGNMENT = alignof( uint64_t );
+
+    struct StoreMapping {
+        const std::byte* data;
+        size_t size;
+
+        ~StoreMapping() {
+            munmap( const_cast<std::byte*>( data ), size );
+        }
+    };
+
+    BigNumberStore make_failed_store() {
+        return { nullptr, {}, make_error( ErrorCode::ERROR ) };
+    }
+
+    BigNumberView make_nan_view( const Error& error ) {
+        return { {}, ZERO_INT, BigNumberType::NOT_A_NUMBER, error, false };
+    }
+
+    std::shared_ptr<const StoreMapping> map_file( const std::string& path ) {
+        int descriptor = open( path.c_str(), O_RDONLY | O_CLOEXEC );
+        if ( descriptor < ZERO_INT ) return nullptr;
+
+        struct stat status;
+        void* data = MAP_FAILED;
+        if ( fstat( descriptor, &status ) == ZERO_INT && status.st_size > 0 )
+            data = mmap( nullptr,
+                         status.st_size,
+                         PROT_READ,
+                         MAP_PRIVATE,
+                         descriptor,
+                         0 );
+        close( descriptor );
+        if ( data == MAP_FAILED ) return nullptr;
+
+        return std::make_shared<const StoreMapping>(
+            static_cast<const std::byte*>( data ),
+            static_cast<size_t>( status.st_size ) );
+    }
+
+    // The index and every record are checked once here, so a store that
+    // opens never serves a malformed value.
+    bool is_valid_index( std::span<const uint64_t> offsets, size_t size ) {
+        uint64_t previous = STORE_HEADER_SIZE + offsets.size_bytes();
+        for ( uint64_t offset : offsets ) {
+            if ( offset < previous || offset > size ||
+                 offset % STORE_ALIGNMENT != ZERO_INT )
+                return false;
+            previous = offset;
+        }
+        return true;
+    }
+
+    bool are_valid_records( const StoreMapping& mapping,
+                            std::span<const uint64_t> offsets ) {
+        for ( size_t i = 0; i + ONE_INT < offsets.size(); ++i ) {
+            BigNumberView view;
+            if ( deserialize( { mapping.data + offsets[i],
+                                offsets[i + ONE_INT] - offsets[i] },
+                              view ) == ZERO_INT )
+                return false;
+        }
+        return true;
+    }
+
+    BigNumberStore open_store( const std::string& path ) {
+        if constexpr ( std::endian::native != std::endian::little )
+            return make_failed_store();
+
+        std::shared_ptr<const StoreMapping> mapping = map_file( path );
+        if ( mapping == nullptr || mapping->size < STORE_HEADER_SIZE )
+            return make_failed_store();
+
+        const std::byte* data = mapping->data;
+        uint32_t version;
+        uint64_t count;
+        std::memcpy( &version, data + 4, sizeof( version ) );
+        std::memcpy( &count, data + 8, sizeof( count ) );
+        if ( std::memcmp( data, STORE_MAGIC, sizeof( STORE_MAGIC ) ) != 0 ||
+             version != STORE_VERSION ||
+             count >= ( mapping->size - STORE_HEADER_SIZE ) / sizeof( count ) )
+            return make_failed_store();
+
+        std::span<const uint64_t> offsets(
+            reinterpret_cast<const uint64_t*>( data + STORE_HEADER_SIZE ),
+            count + ONE_INT );
+        if ( !is_valid_index( offsets, mapping->size ) ||
+             !are_valid_records( *mapping, offsets ) )
+            return make_failed_store();
+
+        return { std::move( mapping ), offsets, get_default_error() };
+    }
+
+    size_t get_store_size( const BigNumberStore& store ) {
+        return store.offsets.empty() ? ZERO_INT
+                                     : store.offsets.size() - ONE_INT;
+    }
+
+    // The view points into the mapping, so it stays valid while the store
+    // (or a copy of it) is alive.
+    BigNumberView get_store_value( const BigNumberStore& store,
+                                   size_t index ) {
+        if ( index >= get_store_size( store ) )
+            return make_nan_view( make_error( ErrorCode::ERROR ) );
+
+        uint64_t first = store.offsets[index];
+        uint64_t last = store.offsets[index + ONE_INT];
+        BigNumberView view;
+        if ( deserialize( { store.mapping->data + first, last - first },
+                          view ) == ZERO_INT )
+            return make_nan_view( make_error( ErrorCode::ERROR ) );
+        return view;
+    }
+
+    void append_bytes( std::vector<std::byte>& buffer,
+                       const void* value,
+                       size_t size ) {
+        const auto* bytes = static_cast<const std::byte*>( value );
+        buffer.insert( buffer.end(), bytes, bytes + size );
+    }
+
+    void write_bytes( std::ofstream& file,
+                      const std::vector<std::byte>& buffer ) {
+        file.write( reinterpret_cast<const char*>( buffer.data() ),
+                    static_cast<std::streamsize>( buffer.size() ) );
+    }
+
+    Error write_store( const std::string& path,
+                       std::span<const BigNumber> numbers ) {
+        if constexpr ( std::endian::native != std::endian::little )
+            return make_error( ErrorCode::ERROR );
+
+        // open_store() rejects the whole file for one unreadable record, so
+        // nothing is written unless every value serializes.
+        for ( const BigNumber& number : numbers ) {
+            if ( !is_serializable( make_view( number ) ) )
+                return make_error( ErrorCode::ERROR );
+        }
+
+        uint64_t count = numbers.size();
+        std::vector<uint64_t> offsets;
+        offsets.reserve( count + ONE_INT );
+        uint64_t offset =
+            STORE_HEADER_SIZE + ( count + ONE_INT ) * sizeof( uint64_t );
+        for ( const BigNumber& number : numbers ) {
+            offsets.push_back( offset );
+            offset += serialized_size( number );
+        }
+        offsets.push_back( offset );
+
+        std::vector<std::byte> buffer;
+        append_bytes( buffer, STORE_MAGIC, sizeof( STORE_MAGIC ) );
+        append_bytes( buffer, &STORE_VERSION, sizeof( STORE_VERSION ) );
+        append_bytes( buffer, &count, sizeof( count ) );
+        append_bytes(
+            buffer, offsets.data(), offsets.size() * sizeof( uint64_t ) );
+
+        std::ofstream file( path, std::ios::binary | std::ios::trunc );
+        write_bytes( file, buffer );
+        for ( const BigNumber& number : numbers ) {
+            buffer.resize( serialized_size( number ) );
+            serialize( number, buffer );
+            write_bytes( file, buffer );
+        }
+        file.close();
+        return make_error( file ? ErrorCode::OK : ErrorCode::ERROR );
+    }
+}
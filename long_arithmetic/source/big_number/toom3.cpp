@@ -0,0 +1,170 @@
+#include <algorithm>
+
+#include "constants.hpp"
+#include "mul.hpp"
+#include "natural.hpp"
+
+namespace big_number {
+    struct SignedChunks {
+        chunks magnitude;
+        bool is_negative;
+    };
+
+    SignedChunks make_signed_chunks( chunks_view value ) {
+        chunks_view trimmed = trim_chunks( value );
+        return { chunks( trimmed.begin(), trimmed.end() ), false };
+    }
+
+    SignedChunks add_signed_chunks( const SignedChunks& lhs,
+                                    const SignedChunks& rhs ) {
+        if ( lhs.is_negative == rhs.is_negative )
+            return { add_chunks( lhs.magnitude, rhs.magnitude ),
+                     lhs.is_negative };
+
+        if ( compare_chunks( lhs.magnitude, rhs.magnitude ) >= 0 )
+            return { sub_chunks( lhs.magnitude, rhs.magnitude ),
+                     lhs.is_negative };
+
+        return { sub_chunks( rhs.magnitude, lhs.magnitude ), rhs.is_negative };
+    }
+
+    SignedChunks sub_signed_chunks( const SignedChunks& lhs,
+                                    const SignedChunks& rhs ) {
+        return add_signed_chunks( lhs, { rhs.magnitude, !rhs.is_negative } );
+    }
+
+    SignedChunks mul_signed_chunks( const SignedChunks& lhs,
+                                    const SignedChunks& rhs ) {
+        chunks_view lhs_magnitude = trim_chunks( lhs.magnitude );
+        chunks_view rhs_magnitude = trim_chunks( rhs.magnitude );
+        if ( lhs_magnitude.empty() || rhs_magnitude.empty() )
+            return { {}, false };
+
+        chunks product( lhs_magnitude.size() + rhs_magnitude.size() );
+        multiply_into( lhs_magnitude, rhs_magnitude, product );
+
+        return { std::move( product ), lhs.is_negative != rhs.is_negative };
+    }
+
+    SignedChunks mul_signed_chunks( const SignedChunks& value,
+                                    chunk factor ) {
+        return { mul_chunks_small( value.magnitude, factor ),
+                 value.is_negative };
+    }
+
+    SignedChunks div_signed_chunks( SignedChunks value, chunk divisor ) {
+        div_chunks_small( value.magnitude, divisor );
+        return value;
+    }
+
+    SignedChunks sqr_signed_chunks( const SignedChunks& value ) {
+        chunks_view magnitude = trim_chunks( value.magnitude );
+        if ( magnitude.empty() ) return { {}, false };
+
+        chunks square( 2 * magnitude.size() );
+        square_into( magnitude, square );
+
+        return { std::move( square ), false };
+    }
+
+    // Values of a three-part operand at the points 1, -1 and -2.
+    struct ToomPoints {
+        SignedChunks at_1;
+        SignedChunks at_m1;
+        SignedChunks at_m2;
+    };
+
+    ToomPoints evaluate_toom3( chunks_view value, size_t part ) {
+        SignedChunks value0 = make_signed_chunks( value.first( part ) );
+        SignedChunks value1 = make_signed_chunks( value.subspan( part, part ) );
+        SignedChunks value2 = make_signed_chunks( value.subspan( 2 * part ) );
+
+        SignedChunks value02 = add_signed_chunks( value0, value2 );
+        SignedChunks at_m1 = sub_signed_chunks( value02, value1 );
+        SignedChunks at_m2 = sub_signed_chunks(
+            mul_signed_chunks( add_signed_chunks( at_m1, value2 ), 2 ),
+            value0 );
+
+        return { add_signed_chunks( value02, value1 ),
+                 std::move( at_m1 ),
+                 std::move( at_m2 ) };
+    }
+
+    // The products at 0 and infinity already sit in the low and high parts
+    // of product; the three middle coefficients are recovered with exact
+    // divisions by 2 and 3 only and added on top.
+    void interpolate_toom3( chunks_span product,
+                            size_t part,
+                            const SignedChunks& at_1,
+                            const SignedChunks& at_m1,
+                            const SignedChunks& at_m2 ) {
+        SignedChunks at_0 = make_signed_chunks( product.first( 2 * part ) );
+        SignedChunks at_inf = make_signed_chunks( product.subspan( 4 * part ) );
+
+        SignedChunks coeff3 =
+            div_signed_chunks( sub_signed_chunks( at_m2, at_1 ), 3 );
+        SignedChunks coeff1 =
+            div_signed_chunks( sub_signed_chunks( at_1, at_m1 ), 2 );
+        SignedChunks coeff2 = sub_signed_chunks( at_m1, at_0 );
+
+        coeff3 = add_signed_chunks(
+            div_signed_chunks( sub_signed_chunks( coeff2, coeff3 ), 2 ),
+            mul_signed_chunks( at_inf, 2 ) );
+        coeff2 =
+            sub_signed_chunks( add_signed_chunks( coeff2, coeff1 ), at_inf );
+        coeff1 = sub_signed_chunks( coeff1, coeff3 );
+
+        add_chunks_into( product.subspan( part ),
+                         trim_chunks( coeff1.magnitude ) );
+        add_chunks_into( product.subspan( 2 * part ),
+                         trim_chunks( coeff2.magnitude ) );
+        add_chunks_into( product.subspan( 3 * part ),
+                         trim_chunks( coeff3.magnitude ) );
+    }
+
+    // Bodrato's sequence: evaluate at 0, 1, -1, -2 and infinity, multiply
+    // pointwise, then interpolate.
+    void
+    toom3_mul_into( chunks_view lhs, chunks_view rhs, chunks_span product ) {
+        if ( lhs.size() < rhs.size() ) std::swap( lhs, rhs );
+
+        size_t part = ( lhs.size() + 2 ) / 3;
+        if ( rhs.size() <= 2 * part )
+            return karatsuba_mul_into( lhs, rhs, product );
+
+        ToomPoints lhs_points = evaluate_toom3( lhs, part );
+        ToomPoints rhs_points = evaluate_toom3( rhs, part );
+
+        std::ranges::fill( product.subspan( 2 * part, 2 * part ), ZERO_INT );
+        multiply_into(
+            lhs.first( part ), rhs.first( part ), product.first( 2 * part ) );
+        multiply_into( lhs.subspan( 2 * part ),
+                       rhs.subspan( 2 * part ),
+                       product.subspan( 4 * part ) );
+
+        interpolate_toom3(
+            product,
+            part,
+            mul_signed_chunks( lhs_points.at_1, rhs_points.at_1 ),
+            mul_signed_chunks( lhs_points.at_m1, rhs_points.at_m1 ),
+            mul_signed_chunks( lhs_points.at_m2, rhs_points.at_m2 ) );
+    }
+
+    void toom3_sqr_into( chunks_view value, chunks_span product ) {
+        size_t part = ( value.size() + 2 ) / 3;
+        if ( value.size() <= 2 * part )
+            return karatsuba_sqr_into( value, product );
+
+        ToomPoints points = evaluate_toom3( value, part );
+
+        std::ranges::fill( product.subspan( 2 * part, 2 * part ), ZERO_INT );
+        square_into( value.first( part ), product.first( 2 * part ) );
+        square_into( value.subspan( 2 * part ), product.subspan( 4 * part ) );
+
+        interpolate_toom3( product,
+                           part,
+                           sqr_signed_chunks( points.at_1 ),
+                           sqr_signed_chunks( points.at_m1 ),
+                           sqr_signed_chunks( points.at_m2 ) );
+    }
+}
@@ -0,0 +1,127 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include "big_number.hpp"
+
+namespace big_number {
+    WorkerPool::WorkerPool( size_t workers ) {
+        threads.reserve( workers );
+        for ( size_t i = 0; i < workers; ++i ) {
+            threads.emplace_back( [this] { work(); } );
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard lock( mutex );
+            is_stopping = true;
+        }
+        has_work.notify_all();
+
+        for ( std::thread& thread : threads ) {
+            thread.join();
+        }
+    }
+
+    // One run() call. It lives in the caller's frame, which run() only
+    // leaves once remaining is zero, so jobs may refer to it.
+    struct WorkerPool::Batch {
+        size_t remaining;
+        std::exception_ptr error;
+    };
+
+    static std::exception_ptr
+    run_task( const std::function<void( size_t )>& task, size_t index ) {
+        try {
+            task( index );
+        } catch ( ... ) {
+            return std::current_exception();
+        }
+        return nullptr;
+    }
+
+    // Notifies under the lock: once it is released, the caller may return
+    // and take the batch with it.
+    void WorkerPool::finish( Batch& batch, std::exception_ptr error ) {
+        std::lock_guard lock( mutex );
+        if ( batch.error == nullptr ) batch.error = std::move( error );
+        if ( --batch.remaining == 0 ) has_work.notify_all();
+    }
+
+    void WorkerPool::run( size_t count,
+                          const std::function<void( size_t )>& task ) {
+        if ( count == 0 ) return;
+
+        Batch batch{ count, nullptr };
+        {
+            std::lock_guard lock( mutex );
+            for ( size_t i = 1; i < count; ++i ) {
+                queue.emplace_back( [this, &task, &batch, i] {
+                    finish( batch, run_task( task, i ) );
+                } );
+            }
+        }
+        has_work.notify_all();
+
+        finish( batch, run_task( task, 0 ) );
+
+        std::unique_lock lock( mutex );
+        while ( batch.remaining != 0 ) {
+            if ( queue.empty() ) {
+                has_work.wait( lock );
+                continue;
+            }
+
+            std::function<void()> job = std::move( queue.front() );
+            queue.pop_front();
+            lock.unlock();
+            job();
+            lock.lock();
+        }
+
+        if ( batch.error != nullptr ) std::rethrow_exception( batch.error );
+    }
+
+    void WorkerPool::work() {
+        while ( true ) {
+            std::function<void()> job;
+            {
+                std::unique_lock lock( mutex );
+                has_work.wait( lock, [this] {
+                    return is_stopping || !queue.empty();
+                } );
+                if ( queue.empty() ) return;
+
+                job = std::move( queue.front() );
+                queue.pop_front();
+            }
+
+            job();
+        }
+    }
+
+    static std::mutex mul_pool_mutex;
+    static std::shared_ptr<WorkerPool> mul_pool;
+    static std::atomic<size_t> mul_threads = 1;
+
+    std::shared_ptr<WorkerPool> get_mul_pool() {
+        std::lock_guard lock( mul_pool_mutex );
+        return mul_pool;
+    }
+
+    void set_mul_threads( size_t threads ) {
+        if ( threads == 0 )
+            threads = std::max( std::thread::hardware_concurrency(), 1U );
+
+        std::shared_ptr<WorkerPool> pool =
+            threads > 1 ? std::make_shared<WorkerPool>( threads - 1 ) : nullptr;
+
+        std::lock_guard lock( mul_pool_mutex );
+        mul_pool.swap( pool );
+        mul_threads.store( threads );
+    }
+
+    size_t get_mul_threads() { return mul_threads.load(); }
+}
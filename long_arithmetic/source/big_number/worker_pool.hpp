@@ -0,0 +1,59 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace big_number {
+    // Fixed set of threads that execute indexed tasks. A thread waiting for
+    // its batch runs queued tasks itself, so batches may be submitted from
+    // inside other tasks without starving the pool. Once the queue is empty
+    // it sleeps until the last task of its batch is done.
+    class WorkerPool {
+      public:
+        explicit WorkerPool( size_t workers );
+        ~WorkerPool();
+
+        WorkerPool( const WorkerPool& ) = delete;
+        WorkerPool& operator=( const WorkerPool& ) = delete;
+
+        // Runs task( 0 ), ..., task( count - 1 ) and returns once all are
+        // done; the calling thread takes part in the work. If tasks throw,
+        // the first exception is rethrown after the others have finished.
+        void run( size_t count, const std::function<void( size_t )>& task );
+
+      private:
+        struct Batch;
+
+        void finish( Batch& batch, std::exception_ptr error );
+        void work();
+
+        std::vector<std::thread> threads;
+        std::deque<std::function<void()>> queue;
+        std::mutex mutex;
+        // Signalled for new jobs and for finished batches.
+        std::condition_variable has_work;
+        bool is_stopping = false;
+    };
+
+    // Runs the tasks on the pool, or one after another without one; only
+    // the pool needs a type-erased task.
+    template <typename Task>
+    void run_parallel( WorkerPool* pool, size_t count, const Task& task ) {
+        if ( pool != nullptr && count > 1 ) return pool->run( count, task );
+
+        for ( size_t i = 0; i < count; ++i ) {
+            task( i );
+        }
+    }
+
+    // Pool shared by the multiplication kernels and the series engine;
+    // empty in single-threaded mode, see set_mul_threads().
+    std::shared_ptr<WorkerPool> get_mul_pool();
+}
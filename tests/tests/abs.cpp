@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <utility>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "error.hpp"
@@ -68,3 +70,24 @@ TEST_F( BigNumberAbsTest, NegativeInfinityBecomesPositiveInfinity ) {
 
     EXPECT_TRUE( is_equal( result, expected ) );
 }
+
+TEST_F( BigNumberAbsTest, TemporaryKeepsItsMantissa ) {
+    auto number = create_big_number( { 4, 5, 6, 7, 8, 9 }, 1, true );
+    auto expected = create_big_number( { 4, 5, 6, 7, 8, 9 }, 1, false );
+    const chunk* data = number.mantissa.data();
+
+    auto result = abs( std::move( number ) );
+
+    EXPECT_EQ( result.mantissa.data(), data );
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberAbsTest, ViewSharesTheMantissa ) {
+    auto number = create_big_number( { 4, 5, 6 }, -3, true );
+
+    BigNumberView result = abs( make_view( number ) );
+
+    EXPECT_EQ( result.mantissa.data(), number.mantissa.data() );
+    EXPECT_FALSE( result.is_negative );
+    EXPECT_EQ( result.shift, -3 );
+}
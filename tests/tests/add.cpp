@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "error.hpp"
@@ -10,6 +12,43 @@ using namespace big_number;
 class BigNumberAddTest : public ::testing::Test {
 protected:
     Error error = get_default_error();
+
+    // Special values, both signs, overlapping and disjoint ranges, and
+    // carries out of the top chunk.
+    std::vector<BigNumber> create_assign_operands() {
+        std::vector<BigNumber> numbers = {
+            make_zero( error ),
+            make_inf( error, true ),
+            make_nan( error ),
+            create_big_number( chunks( MAX_CHUNKS, 999999999 ), 0 ),
+            create_big_number( { 999999999999999999, 999999999999999999 },
+                               0 ) };
+        uint64_t seed = 0;
+        for ( int32_t shift : { -7, 0, 3, 12 } ) {
+            for ( size_t size : { 1, 5, 40 } ) {
+                chunks values = create_random_chunks( size, ++seed );
+                values.back() = values.back() % 1000 + 1;
+                numbers.push_back( create_big_number( values, shift, false ) );
+                numbers.push_back( create_big_number( values, shift, true ) );
+            }
+        }
+        return numbers;
+    }
+
+    // Low-only parts, gaps, partial and full overlaps and tails on either
+    // side, with random chunks so the carries are irregular.
+    static std::vector<BigNumber> create_layout_operands() {
+        std::vector<BigNumber> numbers;
+        uint64_t seed = 100;
+        for ( int32_t shift : { -9, -4, 0, 2, 11 } ) {
+            for ( size_t size : { 1, 3, 8 } ) {
+                chunks values = create_random_chunks( size, ++seed );
+                numbers.push_back( create_big_number( values, shift, false ) );
+                numbers.push_back( create_big_number( values, shift, true ) );
+            }
+        }
+        return numbers;
+    }
 };
 
 TEST_F( BigNumberAddTest, AddTwoPositiveNumbers ) {
@@ -183,3 +222,65 @@ TEST_F( BigNumberAddTest, AddPositiveAndNegativeInfinity ) {
 
     EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
 }
+
+TEST_F( BigNumberAddTest, AddAssignMatchesAdd ) {
+    std::vector<BigNumber> numbers = create_assign_operands();
+
+    for ( const BigNumber& lhs : numbers ) {
+        for ( const BigNumber& rhs : numbers ) {
+            BigNumber expected = add( lhs, rhs );
+            BigNumber result = lhs;
+
+            add_assign( result, rhs );
+
+            EXPECT_TRUE( is_equal( result, expected ) ||
+                         ( result.type == BigNumberType::NOT_A_NUMBER &&
+                           expected.type == BigNumberType::NOT_A_NUMBER ) )
+                << to_string( lhs ) << " + " << to_string( rhs );
+        }
+    }
+}
+
+TEST_F( BigNumberAddTest, AddAssignReusesMantissa ) {
+    BigNumber accumulator = create_big_number( { 1, 2, 3, 4 }, -2 );
+    BigNumber addend = create_big_number( { 5 }, -1 );
+    BigNumber expected = accumulator;
+    const chunk* data = accumulator.mantissa.data();
+
+    for ( int i = 0; i < 100; ++i ) {
+        add_assign( accumulator, addend );
+        expected = add( expected, addend );
+    }
+
+    EXPECT_EQ( accumulator.mantissa.data(), data );
+    EXPECT_TRUE( is_equal( accumulator, expected ) );
+}
+
+TEST_F( BigNumberAddTest, AddAssignToItself ) {
+    BigNumber accumulator = create_big_number( { 999999999999999999 }, 2 );
+    BigNumber expected =
+        create_big_number( { 999999999999999998, 1 }, 2, false );
+    BigNumber viewed = accumulator;
+
+    add_assign( accumulator, accumulator );
+    add_assign( viewed, make_view( viewed ) );
+
+    EXPECT_TRUE( is_equal( accumulator, expected ) );
+    EXPECT_TRUE( is_equal( viewed, expected ) );
+}
+
+TEST_F( BigNumberAddTest, AddMatchesGmpAcrossLayouts ) {
+    std::vector<BigNumber> numbers = create_layout_operands();
+    constexpr int32_t MIN_EXPONENT = -20;
+
+    for ( const BigNumber& lhs : numbers ) {
+        for ( const BigNumber& rhs : numbers ) {
+            BigNumber result = add( lhs, rhs );
+
+            EXPECT_EQ( to_scaled_mpz( result, MIN_EXPONENT ),
+                       to_scaled_mpz( lhs, MIN_EXPONENT ) +
+                           to_scaled_mpz( rhs, MIN_EXPONENT ) )
+                << to_string( lhs ) << " + " << to_string( rhs );
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+class BigNumberCompareTest : public ::testing::Test {
+protected:
+    Error error = get_default_error();
+
+    // Ascending: every number is strictly below the next one.
+    std::vector<BigNumber> create_ascending() {
+        return { make_inf( error, true ),
+                 create_big_number( { 1 }, 3, true ),
+                 create_big_number( { 5, 7 }, 0, true ),
+                 create_big_number( { 7 }, 1, true ),
+                 create_big_number( { 1 }, -2, true ),
+                 make_zero( error ),
+                 create_big_number( { 1 }, -2, false ),
+                 create_big_number( { 2 }, -1, false ),
+                 create_big_number( { 1, 2 }, -2, false ),
+                 create_big_number( { 7 }, 1, false ),
+                 create_big_number( { 5, 7 }, 0, false ),
+                 create_big_number( { 1 }, 3, false ),
+                 make_inf( error, false ) };
+    }
+};
+
+TEST_F( BigNumberCompareTest, OrdersTheNumberLine ) {
+    std::vector<BigNumber> numbers = create_ascending();
+
+    for ( size_t i = 0; i < numbers.size(); ++i ) {
+        for ( size_t j = 0; j < numbers.size(); ++j ) {
+            int expected = ( i > j ) - ( i < j );
+
+            EXPECT_EQ( compare( numbers[i], numbers[j] ), expected )
+                << i << " vs " << j;
+            EXPECT_EQ( is_lower_than( numbers[i], numbers[j] ), i < j )
+                << i << " vs " << j;
+        }
+    }
+}
+
+TEST_F( BigNumberCompareTest, EqualValuesCompareEqual ) {
+    auto lhs = create_big_number( { 3, 0, 9 }, -1, true );
+    auto rhs = create_big_number( { 3, 0, 9 }, -1, true );
+
+    EXPECT_EQ( compare( lhs, rhs ), 0 );
+    EXPECT_EQ( compare( make_zero( error, true ), make_zero( error ) ), 0 );
+    EXPECT_EQ( compare( make_inf( error, false ), make_inf( error, false ) ),
+               0 );
+}
+
+TEST_F( BigNumberCompareTest, NanSortsAboveEverything ) {
+    BigNumber nan = make_nan( error );
+
+    EXPECT_EQ( compare( nan, make_inf( error, false ) ), 1 );
+    EXPECT_EQ( compare( make_zero( error ), nan ), -1 );
+    EXPECT_EQ( compare( nan, make_nan( error, true ) ), 0 );
+    EXPECT_EQ( compare_abs( make_inf( error, true ), nan ), -1 );
+    EXPECT_FALSE( is_lower_than( make_zero( error ), nan ) );
+}
+
+TEST_F( BigNumberCompareTest, CompareAbsIgnoresSigns ) {
+    auto small = create_big_number( { 9 }, -1, false );
+    auto large = create_big_number( { 1, 1 }, -1, true );
+
+    EXPECT_EQ( compare_abs( small, large ), -1 );
+    EXPECT_EQ( compare_abs( large, small ), 1 );
+    EXPECT_EQ( compare_abs( large, neg( large ) ), 0 );
+    EXPECT_EQ( compare_abs( make_zero( error ), small ), -1 );
+    EXPECT_EQ( compare_abs( make_inf( error, true ), large ), 1 );
+}
+
+TEST_F( BigNumberCompareTest, SortMatchesGmp ) {
+    std::vector<BigNumber> numbers;
+    for ( uint64_t seed = 1; seed <= 60; ++seed ) {
+        chunks values = create_random_chunks( seed % 4 + 1, seed );
+        numbers.push_back( create_big_number(
+            values, static_cast<int32_t>( seed % 5 ), seed % 3 == 0 ) );
+    }
+
+    std::ranges::sort( numbers, []( const BigNumber& a, const BigNumber& b ) {
+        return compare( a, b ) < 0;
+    } );
+
+    auto to_value = []( const BigNumber& number ) {
+        mpz_class scale;
+        mpz_ui_pow_ui( scale.get_mpz_t(), 10, BASE * number.shift );
+        mpz_class result = to_mpz( number.mantissa ) * scale;
+        return number.is_negative ? mpz_class( -result ) : result;
+    };
+    for ( size_t i = 1; i < numbers.size(); ++i ) {
+        EXPECT_LE( to_value( numbers[i - 1] ), to_value( numbers[i] ) );
+    }
+}
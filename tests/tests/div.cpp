@@ -0,0 +1,305 @@
+#include <gtest/gtest.h>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+class BigNumberDivTest : public ::testing::Test {
+protected:
+    Error error = get_default_error();
+
+    void expect_div_rem_matches_gmp( size_t dividend_size,
+                                     size_t divisor_size ) {
+        chunks dividend_chunks =
+            create_random_chunks( dividend_size, dividend_size );
+        chunks divisor_chunks =
+            create_random_chunks( divisor_size, divisor_size + 7 );
+        BigNumber dividend = create_big_number( dividend_chunks, 0, true );
+        BigNumber divisor = create_big_number( divisor_chunks, 0, false );
+
+        DivRem result = div_rem( dividend, divisor );
+
+        mpz_class lhs = -to_mpz( dividend_chunks );
+        mpz_class rhs = to_mpz( divisor_chunks );
+        EXPECT_EQ( to_scaled_mpz( result.quotient, 0 ),
+                   mpz_class( lhs / rhs ) )
+            << dividend_size << "/" << divisor_size;
+        EXPECT_EQ( to_scaled_mpz( result.remainder, 0 ),
+                   mpz_class( lhs % rhs ) )
+            << dividend_size << "/" << divisor_size;
+    }
+
+    // A quotient longer than MAX_CHUNKS chunks keeps its top MAX_CHUNKS
+    // chunks; the remainder stays exact.
+    void expect_long_div_rem_matches_gmp( size_t dividend_size,
+                                          int32_t shift ) {
+        chunks dividend_chunks =
+            create_random_chunks( dividend_size, dividend_size + 1 );
+        BigNumber dividend = create_big_number( dividend_chunks, shift );
+        BigNumber divisor = create_big_number( { 7 }, 0 );
+
+        DivRem result = div_rem( dividend, divisor );
+
+        mpz_class lhs = to_scaled_mpz( dividend, 0 );
+        mpz_class quotient = lhs / 7;
+        int32_t chunk_count = static_cast<int32_t>(
+            ( mpz_sizeinbase( quotient.get_mpz_t(), 10 ) + BASE - 1 ) /
+            BASE );
+        if ( power_of_base( chunk_count - 1 ) > quotient ) --chunk_count;
+        int32_t unit = chunk_count - static_cast<int32_t>( MAX_CHUNKS );
+        ASSERT_GT( unit, 0 );
+        EXPECT_EQ( to_scaled_mpz( result.quotient, unit ),
+                   mpz_class( quotient / power_of_base( unit ) ) )
+            << dividend_size << " " << shift;
+        EXPECT_EQ( to_scaled_mpz( result.remainder, 0 ),
+                   mpz_class( lhs % 7 ) )
+            << dividend_size << " " << shift;
+    }
+
+    // div() truncates to MAX_CHUNKS chunks and never below -MAX_SHIFT, so
+    // the dropped part of the quotient is below one unit of its last chunk.
+    void expect_quotient_matches_gmp( size_t dividend_size,
+                                      size_t divisor_size ) {
+        chunks dividend_chunks =
+            create_random_chunks( dividend_size, dividend_size + 3 );
+        chunks divisor_chunks =
+            create_random_chunks( divisor_size, divisor_size + 5 );
+        BigNumber dividend = create_big_number( dividend_chunks, 0, false );
+        BigNumber divisor = create_big_number( divisor_chunks, 0, true );
+
+        BigNumber result = div( dividend, divisor );
+
+        ASSERT_EQ( result.type, BigNumberType::DEFAULT );
+        ASSERT_LE( result.mantissa.size(), MAX_CHUNKS );
+        EXPECT_TRUE( result.is_negative );
+
+        int32_t unit = std::max(
+            result.shift + static_cast<int32_t>( result.mantissa.size() ) -
+                static_cast<int32_t>( MAX_CHUNKS ),
+            -MAX_SHIFT );
+        int32_t exponent = std::min( unit, 0 );
+        mpz_class lhs = to_scaled_mpz( dividend, exponent );
+        mpz_class rhs = to_mpz( divisor_chunks );
+        mpz_class rest = lhs + to_scaled_mpz( result, exponent ) * rhs;
+
+        EXPECT_GE( rest, 0 ) << dividend_size << "/" << divisor_size;
+        EXPECT_LT( rest, rhs * power_of_base( unit - exponent ) )
+            << dividend_size << "/" << divisor_size;
+    }
+
+    // Builds quotient * divisor + remainder and checks that div_rem()
+    // recovers both parts.
+    void expect_div_rem_recovers( const BigNumber& quotient,
+                                  const BigNumber& divisor,
+                                  const BigNumber& remainder ) {
+        BigNumber dividend = add( mul( quotient, divisor ), remainder );
+
+        DivRem result = div_rem( dividend, divisor );
+
+        EXPECT_TRUE( is_equal( result.quotient, quotient ) )
+            << quotient.mantissa.size() << "/" << divisor.mantissa.size();
+        EXPECT_TRUE( is_equal( result.remainder, remainder ) )
+            << quotient.mantissa.size() << "/" << divisor.mantissa.size();
+    }
+};
+
+TEST_F( BigNumberDivTest, DivideSmallNumbers ) {
+    BigNumber a = create_big_number( { 6 }, 0, false );
+    BigNumber b = create_big_number( { 3 }, 0, false );
+    BigNumber expected = create_big_number( { 2 }, 0, false );
+
+    BigNumber result = div( a, b );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberDivTest, DividePositiveByNegative ) {
+    BigNumber a = create_big_number( { 0, 12 }, 0, false );
+    BigNumber b = create_big_number( { 4 }, 0, true );
+    BigNumber expected = create_big_number( { 3 }, 1, true );
+
+    BigNumber result = div( a, b );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberDivTest, InverseOfFour ) {
+    BigNumber number = create_big_number( { 4 }, 0, false );
+    BigNumber expected = create_big_number( { 250000000000000000 }, -1 );
+
+    BigNumber result = inv( number );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberDivTest, InverseOfZeroIsInfinity ) {
+    BigNumber zero = make_zero( error );
+
+    BigNumber result = inv( zero );
+
+    EXPECT_TRUE( result.type == BigNumberType::INF );
+}
+
+TEST_F( BigNumberDivTest, InverseOfInfinityIsZero ) {
+    BigNumber inf = make_inf( error, true );
+
+    BigNumber result = inv( inf );
+
+    EXPECT_TRUE( result.type == BigNumberType::ZERO );
+}
+
+TEST_F( BigNumberDivTest, DivideNumberByZero ) {
+    BigNumber number = create_big_number( { 123 }, 0, true );
+    BigNumber zero = make_zero( error );
+
+    BigNumber result = div( number, zero );
+
+    EXPECT_TRUE( result.type == BigNumberType::INF );
+    EXPECT_TRUE( result.is_negative );
+}
+
+TEST_F( BigNumberDivTest, DivideZeroByZero ) {
+    BigNumber zero1 = make_zero( error );
+    BigNumber zero2 = make_zero( error );
+
+    BigNumber result = div( zero1, zero2 );
+
+    EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberDivTest, DivideNumberByInfinity ) {
+    BigNumber number = create_big_number( { 123 }, 0, false );
+    BigNumber inf = make_inf( error, false );
+
+    BigNumber result = div( number, inf );
+
+    EXPECT_TRUE( result.type == BigNumberType::ZERO );
+}
+
+TEST_F( BigNumberDivTest, DivideInfinityByNumber ) {
+    BigNumber inf = make_inf( error, false );
+    BigNumber number = create_big_number( { 123 }, 0, true );
+
+    BigNumber result = div( inf, number );
+
+    EXPECT_TRUE( result.type == BigNumberType::INF );
+    EXPECT_TRUE( result.is_negative );
+}
+
+TEST_F( BigNumberDivTest, DivideTwoInfinities ) {
+    BigNumber inf1 = make_inf( error, false );
+    BigNumber inf2 = make_inf( error, true );
+
+    BigNumber result = div( inf1, inf2 );
+
+    EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberDivTest, DivideNanByNumber ) {
+    BigNumber nan = make_nan( error );
+    BigNumber number = create_big_number( { 123 }, 0, false );
+
+    BigNumber result = div( nan, number );
+
+    EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberDivTest, DivRemTruncatesTowardZero ) {
+    BigNumber a = create_big_number( { 7 }, 0, true );
+    BigNumber b = create_big_number( { 2 }, 0, false );
+    BigNumber quotient = create_big_number( { 3 }, 0, true );
+    BigNumber remainder = create_big_number( { 1 }, 0, true );
+
+    DivRem result = div_rem( a, b );
+
+    EXPECT_TRUE( is_equal( result.quotient, quotient ) );
+    EXPECT_TRUE( is_equal( result.remainder, remainder ) );
+}
+
+TEST_F( BigNumberDivTest, DivRemWithFractionalDividend ) {
+    BigNumber a = create_big_number( { 500000000000000000, 7 }, -1 );
+    BigNumber b = create_big_number( { 2 }, 0, false );
+    BigNumber quotient = create_big_number( { 3 }, 0, false );
+    BigNumber remainder = create_big_number( { 500000000000000000, 1 }, -1 );
+
+    DivRem result = div_rem( a, b );
+
+    EXPECT_TRUE( is_equal( result.quotient, quotient ) );
+    EXPECT_TRUE( is_equal( result.remainder, remainder ) );
+}
+
+TEST_F( BigNumberDivTest, DivRemByInfinityKeepsDividend ) {
+    BigNumber number = create_big_number( { 123 }, 0, true );
+    BigNumber inf = make_inf( error, false );
+
+    DivRem result = div_rem( number, inf );
+
+    EXPECT_TRUE( result.quotient.type == BigNumberType::ZERO );
+    EXPECT_TRUE( is_equal( result.remainder, number ) );
+}
+
+TEST_F( BigNumberDivTest, DivRemByZeroIsNan ) {
+    BigNumber number = create_big_number( { 123 }, 0, false );
+    BigNumber zero = make_zero( error );
+
+    DivRem result = div_rem( number, zero );
+
+    EXPECT_TRUE( result.quotient.type == BigNumberType::INF );
+    EXPECT_TRUE( result.remainder.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberDivTest, DivRemMatchesGmp ) {
+    const size_t sizes[][2] = { { 1, 1 },       { 3, 5 },
+                                { 7, 1 },       { 40, 2 },
+                                { 150, 100 },   { 900, 199 },
+                                { 600, 200 },   { 2600, 2500 },
+                                { 3000, 2500 }, { MAX_CHUNKS, 1000 },
+                                { MAX_CHUNKS, 2777 } };
+
+    for ( const auto& [dividend_size, divisor_size] : sizes ) {
+        expect_div_rem_matches_gmp( dividend_size, divisor_size );
+    }
+}
+
+TEST_F( BigNumberDivTest, DivRemTruncatesLongQuotients ) {
+    expect_long_div_rem_matches_gmp( 5000, 600 );
+    expect_long_div_rem_matches_gmp( MAX_CHUNKS, 400 );
+}
+
+TEST_F( BigNumberDivTest, DivMatchesGmpToPrecision ) {
+    const size_t sizes[][2] = { { 1, 1 },
+                                { 1, 3 },
+                                { 5, 3 },
+                                { 300, 150 },
+                                { 40, 2500 },
+                                { MAX_CHUNKS, 700 },
+                                { MAX_CHUNKS, MAX_CHUNKS } };
+
+    for ( const auto& [dividend_size, divisor_size] : sizes ) {
+        expect_quotient_matches_gmp( dividend_size, divisor_size );
+    }
+}
+
+TEST_F( BigNumberDivTest, DivRemRecoversEdgeRemainders ) {
+    const size_t sizes[][2] = { { 500, 30 }, { 500, 300 }, { 3000, 2500 } };
+
+    for ( const auto& [quotient_size, divisor_size] : sizes ) {
+        chunks power( divisor_size, 0 );
+        power.back() = HALF_CHUNK;
+        chunks nines( divisor_size, ALMOST_MAX_CHUNK );
+        BigNumber quotient = create_big_number(
+            create_random_chunks( quotient_size, quotient_size ), 0 );
+        BigNumber one = create_big_number( { 1 }, 0 );
+
+        for ( const chunks& divisor_chunks : { power, nines } ) {
+            BigNumber divisor = create_big_number( divisor_chunks, 0 );
+            BigNumber largest = sub( divisor, one );
+
+            expect_div_rem_recovers( quotient, divisor, largest );
+            expect_div_rem_recovers( quotient, divisor, one );
+        }
+    }
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <random>
+#include <string_view>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "tools.hpp"
@@ -323,3 +326,137 @@ TEST_F( InputTest, ErrorCodePropagation ) {
     EXPECT_FALSE( is_ok( result_error ) );
     EXPECT_EQ( get_error_code( result_error ), ErrorCode::ERROR );
 }
+
+class ParseTest : public ::testing::Test {
+protected:
+    Error error = get_default_error();
+
+    static std::string to_text( const digits& digits ) {
+        std::string text;
+        for ( digit value : digits ) {
+            text += static_cast<char>( '0' + value );
+        }
+        return text;
+    }
+
+    static digits create_random_digits( size_t size, uint64_t seed ) {
+        std::mt19937_64 generator( seed );
+        std::uniform_int_distribution<int> distribution( 0, 9 );
+        digits digits( size );
+        for ( digit& value : digits ) {
+            value = static_cast<digit>( distribution( generator ) );
+        }
+        digits[0] = 1 + digits[0] % 9;
+        return digits;
+    }
+};
+
+TEST_F( ParseTest, ParsesInteger ) {
+    BigNumber expected = create_big_number( { 123 }, 0, false );
+
+    BigNumber result = parse( "123" );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( ParseTest, ParsesSignFractionAndExponent ) {
+    BigNumber expected = make_big_number( { 1, 2, 5 }, 38, true, error );
+
+    BigNumber result = parse( "-1.25e+40" );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( ParseTest, SkipsLeadingZeros ) {
+    BigNumber expected =
+        make_big_number( { 1, 2, 3, 4, 5, 0 }, -26, false, error );
+
+    BigNumber result = parse( "+00.000123450e-17" );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( ParseTest, ParsesSpecialValues ) {
+    EXPECT_EQ( parse( "NaN" ).type, BigNumberType::NOT_A_NUMBER );
+    EXPECT_TRUE( is_equal( parse( "-INF" ), make_inf( error, true ) ) );
+    EXPECT_TRUE( is_equal( parse( "0" ), make_zero( error ) ) );
+    EXPECT_TRUE( parse( "-0.000" ).is_negative );
+    EXPECT_EQ( parse( "-0.000" ).type, BigNumberType::ZERO );
+}
+
+TEST_F( ParseTest, MatchesDigitConstructor ) {
+    const size_t sizes[] = { 1, 8, 17, 18, 19, 35, 100, 1000, MAX_DIGITS };
+    const int32_t exponents[] = { 0, 1, -1, 17, -19, 36, -MAX_EXP };
+
+    for ( size_t size : sizes ) {
+        digits digits = create_random_digits( size, size );
+        std::string text = to_text( digits );
+        for ( int32_t exponent : exponents ) {
+            BigNumber expected =
+                make_big_number( digits, exponent, false, error );
+            size_t point = size / 3;
+            int32_t point_exponent = exponent + int32_t( size - point );
+            std::string fraction = text.substr( 0, point ) + "." +
+                                   text.substr( point ) + "e" +
+                                   std::to_string( point_exponent );
+
+            EXPECT_TRUE( is_equal(
+                parse( text + "e" + std::to_string( exponent ) ), expected ) )
+                << size << " " << exponent;
+            EXPECT_TRUE( is_equal( parse( fraction ), expected ) )
+                << size << " " << exponent;
+        }
+    }
+}
+
+TEST_F( ParseTest, RoundTripsToString ) {
+    BigNumber numbers[] = {
+        create_big_number( { 789, 0, 123 }, 4, true ),
+        create_big_number( create_random_chunks( MAX_CHUNKS, 3 ), 0, false ),
+    };
+
+    for ( const BigNumber& number : numbers ) {
+        EXPECT_TRUE( is_equal( parse( to_string( number ) ), number ) );
+    }
+}
+
+TEST_F( ParseTest, OverflowsLikeDigitConstructor ) {
+    std::string digits( MAX_DIGITS + 1, '1' );
+
+    EXPECT_TRUE( is_equal( parse( digits ), make_inf( error, false ) ) );
+    EXPECT_TRUE( is_equal( parse( "-1e200000" ), make_inf( error, true ) ) );
+    EXPECT_TRUE( is_equal( parse( "1e-200000" ), make_zero( error ) ) );
+}
+
+TEST_F( ParseTest, RejectsMalformedText ) {
+    for ( std::string_view text : { "", "-", ".", "1x", "e5", "1e", "--1" } ) {
+        BigNumber result = parse( text );
+
+        EXPECT_EQ( result.type, BigNumberType::NOT_A_NUMBER ) << text;
+        EXPECT_FALSE( is_ok( get_error( result ) ) ) << text;
+    }
+}
+
+TEST_F( ParseTest, FromCharsStopsAtUnparsedText ) {
+    std::string_view text = "12.5e3xyz";
+    BigNumber number;
+
+    auto [ptr, ec] =
+        from_chars( text.data(), text.data() + text.size(), number );
+
+    EXPECT_EQ( ec, std::errc{} );
+    EXPECT_EQ( ptr, text.data() + 6 );
+    EXPECT_TRUE( is_equal( number, create_big_number( { 12500 }, 0 ) ) );
+}
+
+TEST_F( ParseTest, FromCharsKeepsIncompleteExponent ) {
+    std::string_view text = "7e+";
+    BigNumber number;
+
+    auto [ptr, ec] =
+        from_chars( text.data(), text.data() + text.size(), number );
+
+    EXPECT_EQ( ec, std::errc{} );
+    EXPECT_EQ( ptr, text.data() + 1 );
+    EXPECT_TRUE( is_equal( number, create_big_number( { 7 }, 0 ) ) );
+}
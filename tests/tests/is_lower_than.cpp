@@ -143,3 +143,24 @@ TEST_F( BigNumberIsLowerThanTest, NaNVssNaN ) {
     EXPECT_FALSE( is_lower_than( number1, number2 ) );
     EXPECT_FALSE( is_lower_than( number2, number1 ) );
 }
+
+TEST_F( BigNumberIsLowerThanTest, HigherPowerWithFewerChunks ) {
+    auto number1 = create_big_number( { 1, 2 }, 1, false );
+    auto number2 = create_big_number( { 1, 2, 3 }, -1, false );
+
+    EXPECT_FALSE( is_lower_than( number1, number2 ) );
+    EXPECT_TRUE( is_lower_than( number2, number1 ) );
+    EXPECT_TRUE( is_lower_than( neg( number1 ), neg( number2 ) ) );
+    EXPECT_FALSE( is_lower_than( neg( number2 ), neg( number1 ) ) );
+}
+
+TEST_F( BigNumberIsLowerThanTest, EqualPowerDifferentLengths ) {
+    auto number1 = create_big_number( { 5 }, 0, false );
+    auto number2 = create_big_number( { 1, 4 }, -1, false );
+    auto number3 = create_big_number( { 1, 5 }, -1, false );
+
+    EXPECT_TRUE( is_lower_than( number2, number1 ) );
+    EXPECT_FALSE( is_lower_than( number1, number2 ) );
+    EXPECT_TRUE( is_lower_than( number1, number3 ) );
+    EXPECT_TRUE( is_lower_than( neg( number3 ), neg( number1 ) ) );
+}
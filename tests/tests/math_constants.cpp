@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+class BigNumberConstantsTest : public ::testing::Test {
+protected:
+    // The reference sums keep this many digits below the compared ones, so
+    // their floor errors do not reach the last compared digit.
+    static constexpr size_t GUARD_DIGITS = 36;
+
+    static mpz_class power_of_ten( size_t exponent ) {
+        mpz_class result;
+        mpz_ui_pow_ui( result.get_mpz_t(), 10, exponent );
+        return result;
+    }
+
+    // sum over k of scale / ( ( 2k + 1 ) x^( 2k + 1 ) ) with alternating
+    // signs.
+    static mpz_class arctan_of_inverse( unsigned long x,
+                                        const mpz_class& scale ) {
+        mpz_class power = scale / x;
+        mpz_class sum = power;
+        for ( unsigned long k = 1; power != 0; ++k ) {
+            power /= x * x;
+            mpz_class term = power / ( 2 * k + 1 );
+            sum += k % 2 == 0 ? term : mpz_class( -term );
+        }
+        return sum;
+    }
+
+    // floor( pi * 10^digits ) from Machin's formula.
+    static mpz_class reference_pi( size_t digits ) {
+        mpz_class scale = power_of_ten( digits + GUARD_DIGITS );
+        mpz_class sum = 16 * arctan_of_inverse( 5, scale ) -
+                        4 * arctan_of_inverse( 239, scale );
+        return sum / power_of_ten( GUARD_DIGITS );
+    }
+
+    // floor( e * 10^digits ) from the sum of 1 / k!.
+    static mpz_class reference_e( size_t digits ) {
+        mpz_class term = power_of_ten( digits + GUARD_DIGITS );
+        mpz_class sum = 0;
+        for ( unsigned long k = 1; term != 0; ++k ) {
+            sum += term;
+            term /= k;
+        }
+        return sum / power_of_ten( GUARD_DIGITS );
+    }
+
+    // floor( ln( 2 ) * 10^digits ) from the sum of 1 / ( k 2^k ).
+    static mpz_class reference_ln2( size_t digits ) {
+        mpz_class power = power_of_ten( digits + GUARD_DIGITS );
+        mpz_class sum = 0;
+        for ( unsigned long k = 1; power != 0; ++k ) {
+            power /= 2;
+            sum += power / k;
+        }
+        return sum / power_of_ten( GUARD_DIGITS );
+    }
+
+    // number * MAX_CHUNK^fraction as an integer.
+    static mpz_class to_scaled_mpz( const BigNumber& number,
+                                    size_t fraction ) {
+        return to_mpz( number.mantissa ) *
+               power_of_ten( BASE * ( number.shift + fraction ) );
+    }
+
+    void expect_matches_reference( const BigNumber& number,
+                                   size_t fraction,
+                                   const mpz_class& expected ) {
+        ASSERT_EQ( number.type, BigNumberType::DEFAULT );
+        EXPECT_FALSE( number.is_negative );
+        EXPECT_EQ( to_scaled_mpz( number, fraction ), expected );
+    }
+};
+
+TEST_F( BigNumberConstantsTest, PiLeadingChunks ) {
+    BigNumber expected = create_big_number(
+        { 197169399375105820, 462643383279502884, 141592653589793238, 3 },
+        -3 );
+
+    BigNumber result = pi( 4 * BASE );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberConstantsTest, ELeadingChunks ) {
+    BigNumber expected = create_big_number(
+        { 757247093699959574, 360287471352662497, 718281828459045235, 2 },
+        -3 );
+
+    BigNumber result = e( 4 * BASE );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberConstantsTest, Ln2LeadingChunks ) {
+    BigNumber expected = create_big_number(
+        { 75500134360255254, 417232121458176568, 693147180559945309 }, -3 );
+
+    BigNumber result = ln2( 3 * BASE );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberConstantsTest, PiMatchesGmp ) {
+    const size_t fraction = 1111;
+
+    BigNumber result = pi( ( fraction + 1 ) * BASE );
+
+    expect_matches_reference(
+        result, fraction, reference_pi( fraction * BASE ) );
+}
+
+TEST_F( BigNumberConstantsTest, EMatchesGmpAtFullPrecision ) {
+    const size_t fraction = MAX_CHUNKS - 1;
+
+    BigNumber result = e();
+
+    expect_matches_reference(
+        result, fraction, reference_e( fraction * BASE ) );
+}
+
+TEST_F( BigNumberConstantsTest, Ln2MatchesGmp ) {
+    const size_t fraction = 1111;
+
+    BigNumber result = ln2( fraction * BASE );
+
+    expect_matches_reference(
+        result, fraction, reference_ln2( fraction * BASE ) );
+}
+
+TEST_F( BigNumberConstantsTest, ShorterPrecisionIsPrefix ) {
+    clear_constants_cache();
+    BigNumber full = pi();
+    BigNumber cut = pi( 5000 );
+
+    clear_constants_cache();
+    BigNumber shorter = pi( 5000 );
+
+    ASSERT_EQ( full.mantissa.size(), MAX_CHUNKS );
+    EXPECT_EQ( full.shift, 1 - static_cast<int32_t>( MAX_CHUNKS ) );
+    EXPECT_TRUE( is_equal( cut, shorter ) );
+    EXPECT_TRUE( std::equal( shorter.mantissa.rbegin(),
+                             shorter.mantissa.rend(),
+                             full.mantissa.rbegin() ) );
+}
+
+TEST_F( BigNumberConstantsTest, PrecisionIsClamped ) {
+    BigNumber three = create_big_number( { 3 }, 0 );
+
+    EXPECT_TRUE( is_equal( pi( 0 ), three ) );
+    EXPECT_TRUE( is_equal( pi( 2 * PRECISION ), pi() ) );
+}
+
+TEST_F( BigNumberConstantsTest, ParallelSplittingMatchesSerial ) {
+    clear_constants_cache();
+    BigNumber serial = ln2( 40000 );
+
+    for ( size_t threads : { 2, 4 } ) {
+        clear_constants_cache();
+        set_mul_threads( threads );
+
+        BigNumber parallel = ln2( 40000 );
+
+        EXPECT_TRUE( is_equal( parallel, serial ) ) << threads;
+    }
+    set_mul_threads( 1 );
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+class BigNumberMemoryTest : public ::testing::Test {
+protected:
+    // Counts what goes through it on top of the default resource.
+    struct CountingResource : std::pmr::memory_resource {
+        size_t allocations = 0;
+        size_t live_bytes = 0;
+
+        void* do_allocate( size_t bytes, size_t alignment ) override {
+            ++allocations;
+            live_bytes += bytes;
+            return std::pmr::new_delete_resource()->allocate( bytes,
+                                                              alignment );
+        }
+
+        void do_deallocate( void* pointer,
+                            size_t bytes,
+                            size_t alignment ) override {
+            live_bytes -= bytes;
+            std::pmr::new_delete_resource()->deallocate(
+                pointer, bytes, alignment );
+        }
+
+        bool do_is_equal(
+            const std::pmr::memory_resource& other ) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    BigNumber create_long( uint64_t seed ) {
+        return create_big_number( create_random_chunks( 40, seed ), -3 );
+    }
+};
+
+TEST_F( BigNumberMemoryTest, ScopeRoutesResultsToTheResource ) {
+    CountingResource resource;
+    BigNumber lhs = create_long( 1 );
+    BigNumber rhs = create_long( 2 );
+    BigNumber expected = mul( add( lhs, rhs ), rhs );
+
+    {
+        MantissaResourceScope scope( &resource );
+        EXPECT_EQ( get_mantissa_resource(), &resource );
+
+        BigNumber result = mul( add( lhs, rhs ), rhs );
+
+        EXPECT_TRUE( is_equal( result, expected ) );
+        EXPECT_EQ( result.mantissa.get_resource(), &resource );
+        EXPECT_GT( resource.allocations, 0 );
+    }
+
+    EXPECT_EQ( get_mantissa_resource(), nullptr );
+    EXPECT_EQ( resource.live_bytes, 0 );
+}
+
+TEST_F( BigNumberMemoryTest, ShortValuesDoNotAllocate ) {
+    CountingResource resource;
+    MantissaResourceScope scope( &resource );
+
+    BigNumber result = add( create_big_number( { 1, 2 }, 0 ),
+                            create_big_number( { 3 }, 1 ) );
+
+    EXPECT_EQ( result.mantissa.size(), 2 );
+    EXPECT_EQ( resource.allocations, 0 );
+}
+
+TEST_F( BigNumberMemoryTest, OuterValuesKeepTheirResource ) {
+    BigNumber total = create_long( 3 );
+    BigNumber addend = create_long( 4 );
+    BigNumber expected = add( total, addend );
+
+    {
+        std::unique_ptr<std::pmr::memory_resource> arena =
+            make_mantissa_arena( 1024 );
+        MantissaResourceScope scope( arena.get() );
+
+        total = add( total, addend );
+    }
+
+    EXPECT_EQ( total.mantissa.get_resource(), nullptr );
+    EXPECT_TRUE( is_equal( total, expected ) );
+}
+
+TEST_F( BigNumberMemoryTest, PoolMatchesTheHeap ) {
+    std::vector<BigNumber> expected;
+    for ( uint64_t seed = 1; seed <= 20; ++seed ) {
+        expected.push_back( sqr( create_long( seed ) ) );
+    }
+
+    std::unique_ptr<std::pmr::memory_resource> pool = make_mantissa_pool();
+    MantissaResourceScope scope( pool.get() );
+    for ( uint64_t seed = 1; seed <= 20; ++seed ) {
+        EXPECT_TRUE(
+            is_equal( sqr( create_long( seed ) ), expected[seed - 1] ) );
+    }
+}
+
+TEST_F( BigNumberMemoryTest, ConstantsCacheOutlivesTheArena ) {
+    clear_constants_cache();
+    BigNumber inside;
+    {
+        std::unique_ptr<std::pmr::memory_resource> arena =
+            make_mantissa_arena( 1024 );
+        MantissaResourceScope scope( arena.get() );
+        inside = pi( 2000 );
+    }
+
+    EXPECT_TRUE( is_equal( pi( 2000 ), inside ) );
+}
@@ -10,6 +10,49 @@ using namespace big_number;
 class BigNumberMulTest : public ::testing::Test {
 protected:
     Error error = get_default_error();
+
+    void expect_product_matches_gmp( size_t lhs_size,
+                                     size_t rhs_size,
+                                     MulAlgorithm algorithm ) {
+        chunks lhs_chunks = create_random_chunks( lhs_size, lhs_size );
+        chunks rhs_chunks = create_random_chunks( rhs_size, rhs_size + 1 );
+        BigNumber lhs = create_big_number( lhs_chunks, 0, false );
+        BigNumber rhs = create_big_number( rhs_chunks, 0, true );
+
+        BigNumber result = mul( lhs, rhs, algorithm );
+
+        mpz_class expected = to_mpz( lhs_chunks ) * to_mpz( rhs_chunks );
+        mpz_class actual = to_mpz( result.mantissa );
+        for ( int32_t i = 0; i < result.shift; ++i ) {
+            actual *= mpz_class( std::to_string( MAX_CHUNK ) );
+        }
+
+        EXPECT_EQ( actual, expected )
+            << lhs_size << "x" << rhs_size << " algorithm "
+            << static_cast<int>( algorithm );
+        EXPECT_TRUE( result.is_negative );
+    }
+
+    void expect_square_matches_gmp( size_t size, MulAlgorithm algorithm ) {
+        chunks value_chunks = create_random_chunks( size, size );
+        BigNumber value = create_big_number( value_chunks, 1, true );
+        BigNumber copy = create_big_number( value_chunks, 1, true );
+
+        BigNumber square = sqr( value, algorithm );
+        BigNumber product = mul( value, copy, algorithm );
+
+        mpz_class expected = to_mpz( value_chunks ) * to_mpz( value_chunks );
+        mpz_class actual = to_mpz( square.mantissa );
+        for ( int32_t i = 2; i < square.shift; ++i ) {
+            actual *= mpz_class( std::to_string( MAX_CHUNK ) );
+        }
+
+        EXPECT_EQ( actual, expected )
+            << size << " algorithm " << static_cast<int>( algorithm );
+        EXPECT_GE( square.shift, 2 );
+        EXPECT_FALSE( square.is_negative );
+        EXPECT_TRUE( is_equal( square, product ) );
+    }
 };
 
 TEST_F( BigNumberMulTest, MultiplyByZero ) {
@@ -266,3 +309,178 @@ TEST_F( BigNumberMulTest, MultiplyZeroByInfinity ) {
 
     EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
 }
+
+TEST_F( BigNumberMulTest, EveryAlgorithmMatchesGmp ) {
+    const MulAlgorithm algorithms[] = { MulAlgorithm::AUTO,
+                                        MulAlgorithm::SCHOOLBOOK,
+                                        MulAlgorithm::KARATSUBA,
+                                        MulAlgorithm::TOOM3,
+                                        MulAlgorithm::NTT };
+    const size_t sizes[] = { 1, 2, 3, 5, 17, 64, 151, 400, 1100 };
+
+    for ( MulAlgorithm algorithm : algorithms ) {
+        for ( size_t size : sizes ) {
+            expect_product_matches_gmp( size, size, algorithm );
+        }
+    }
+}
+
+TEST_F( BigNumberMulTest, UnbalancedOperandsMatchGmp ) {
+    const MulAlgorithm algorithms[] = { MulAlgorithm::AUTO,
+                                        MulAlgorithm::KARATSUBA,
+                                        MulAlgorithm::TOOM3,
+                                        MulAlgorithm::NTT };
+
+    for ( MulAlgorithm algorithm : algorithms ) {
+        expect_product_matches_gmp( 2000, 37, algorithm );
+        expect_product_matches_gmp( 1500, 1001, algorithm );
+        expect_product_matches_gmp( 700, 300, algorithm );
+        expect_product_matches_gmp( 3, 2500, algorithm );
+    }
+}
+
+TEST_F( BigNumberMulTest, MaxChunksOperandsMatchGmp ) {
+    expect_product_matches_gmp(
+        MAX_CHUNKS / 2, MAX_CHUNKS / 2, MulAlgorithm::AUTO );
+}
+
+TEST_F( BigNumberMulTest, EveryNttBackendMatchesGmp ) {
+    const NttBackend backends[] = {
+        NttBackend::SCALAR, NttBackend::AVX2, NttBackend::AVX512 };
+    const size_t sizes[] = { 1, 2, 5, 64, 1100 };
+
+    for ( NttBackend backend : backends ) {
+        if ( !set_ntt_backend( backend ) ) continue;
+
+        for ( size_t size : sizes ) {
+            expect_product_matches_gmp( size, size, MulAlgorithm::NTT );
+        }
+        expect_product_matches_gmp( 2000, 37, MulAlgorithm::NTT );
+        expect_product_matches_gmp( 1600, 1500, MulAlgorithm::NTT );
+    }
+
+    EXPECT_TRUE( set_ntt_backend( NttBackend::AUTO ) );
+    EXPECT_NE( get_ntt_backend(), NttBackend::AUTO );
+}
+
+TEST_F( BigNumberMulTest, BothNttPackingsMatchGmp ) {
+    expect_product_matches_gmp( 1499, 1500, MulAlgorithm::NTT );
+    expect_product_matches_gmp( 1500, 1500, MulAlgorithm::NTT );
+    expect_product_matches_gmp( 4000, 5, MulAlgorithm::NTT );
+
+    chunks nines( MAX_CHUNKS / 2, MAX_CHUNK - 1 );
+    BigNumber lhs = create_big_number( nines, 0, false );
+    BigNumber rhs = create_big_number( nines, 0, true );
+
+    BigNumber result = mul( lhs, rhs, MulAlgorithm::NTT );
+
+    mpz_class expected = to_mpz( nines ) * to_mpz( nines );
+    mpz_class actual = to_mpz( result.mantissa );
+    for ( int32_t i = 0; i < result.shift; ++i ) {
+        actual *= mpz_class( std::to_string( MAX_CHUNK ) );
+    }
+    EXPECT_EQ( actual, expected );
+    EXPECT_TRUE( result.is_negative );
+}
+
+TEST_F( BigNumberMulTest, NttLengthsPastPowersOfTwoMatchGmp ) {
+    expect_product_matches_gmp( 1100, 1100, MulAlgorithm::NTT );
+    expect_product_matches_gmp( 2100, 2100, MulAlgorithm::NTT );
+    expect_product_matches_gmp( 3900, 1500, MulAlgorithm::NTT );
+    expect_product_matches_gmp( 700, 4000, MulAlgorithm::NTT );
+}
+
+TEST_F( BigNumberMulTest, MultithreadedNttMatchesGmp ) {
+    const size_t thread_counts[] = { 2, 7, 25 };
+
+    for ( size_t threads : thread_counts ) {
+        set_mul_threads( threads );
+        EXPECT_EQ( get_mul_threads(), threads );
+
+        expect_product_matches_gmp( 1100, 1100, MulAlgorithm::NTT );
+        expect_product_matches_gmp( 3000, 37, MulAlgorithm::NTT );
+        expect_product_matches_gmp(
+            MAX_CHUNKS / 2, MAX_CHUNKS / 2, MulAlgorithm::AUTO );
+    }
+
+    set_mul_threads( 1 );
+    EXPECT_EQ( get_mul_threads(), 1 );
+}
+
+TEST_F( BigNumberMulTest, EveryAlgorithmSquaresLikeGmp ) {
+    const MulAlgorithm algorithms[] = { MulAlgorithm::SCHOOLBOOK,
+                                        MulAlgorithm::KARATSUBA,
+                                        MulAlgorithm::TOOM3,
+                                        MulAlgorithm::NTT,
+                                        MulAlgorithm::AUTO };
+    const size_t sizes[] = { 1, 2, 3, 4, 7, 31, 200, 1000, 2500 };
+
+    for ( MulAlgorithm algorithm : algorithms ) {
+        for ( size_t size : sizes ) {
+            expect_square_matches_gmp( size, algorithm );
+        }
+    }
+    expect_square_matches_gmp( MAX_CHUNKS / 2, MulAlgorithm::AUTO );
+}
+
+TEST_F( BigNumberMulTest, SquareSpecialValues ) {
+    BigNumber negative_inf = make_inf( error, true );
+    BigNumber nan = make_nan( error );
+    BigNumber zero = make_zero( error );
+
+    BigNumber inf_square = sqr( negative_inf );
+    EXPECT_EQ( inf_square.type, BigNumberType::INF );
+    EXPECT_FALSE( inf_square.is_negative );
+    EXPECT_EQ( sqr( nan ).type, BigNumberType::NOT_A_NUMBER );
+    EXPECT_EQ( sqr( zero ).type, BigNumberType::ZERO );
+}
+
+TEST_F( BigNumberMulTest, MultiplyNumberBySelf ) {
+    BigNumber number = create_big_number( { 12, 34 }, 0, true );
+    BigNumber expected = create_big_number( { 144, 816, 1156 }, 0, false );
+
+    EXPECT_TRUE( is_equal( mul( number, number ), expected ) );
+}
+
+TEST_F( BigNumberMulTest, PreparedOperandMatchesPlainMul ) {
+    BigNumber constant =
+        create_big_number( create_random_chunks( 2500, 7 ), 3, true );
+    PreparedOperand prepared = prepare_mul( constant );
+    const size_t sizes[] = { 1, 40, 900, 2500, 2500, 1800, 2600 };
+
+    for ( size_t threads : { 1, 7 } ) {
+        set_mul_threads( threads );
+
+        for ( size_t size : sizes ) {
+            BigNumber value =
+                create_big_number( create_random_chunks( size, size ), -2 );
+
+            BigNumber expected = mul( constant, value );
+            BigNumber result = mul( prepared, value );
+
+            EXPECT_TRUE( is_equal( result, expected ) ) << size;
+            EXPECT_EQ( result.shift, expected.shift ) << size;
+            EXPECT_TRUE( result.is_negative ) << size;
+        }
+    }
+    set_mul_threads( 1 );
+
+    PreparedOperand copy = prepared;
+    EXPECT_TRUE( is_equal( mul( copy, constant ), sqr( constant ) ) );
+}
+
+TEST_F( BigNumberMulTest, PreparedSpecialValues ) {
+    BigNumber number = create_big_number( { 123 }, 0, true );
+    PreparedOperand inf = prepare_mul( make_inf( error, false ) );
+    PreparedOperand zero = prepare_mul( make_zero( error ) );
+    PreparedOperand prepared_number = prepare_mul( number );
+
+    BigNumber inf_product = mul( inf, number );
+    EXPECT_EQ( inf_product.type, BigNumberType::INF );
+    EXPECT_TRUE( inf_product.is_negative );
+    EXPECT_EQ( mul( zero, number ).type, BigNumberType::ZERO );
+    EXPECT_EQ( mul( inf, make_zero( error ) ).type,
+               BigNumberType::NOT_A_NUMBER );
+    EXPECT_EQ( mul( prepared_number, make_nan( error ) ).type,
+               BigNumberType::NOT_A_NUMBER );
+}
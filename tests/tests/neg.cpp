@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <utility>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "tools.hpp"
@@ -76,3 +78,24 @@ TEST_F( BigNumberNegTest, NumberWithShiftRemainsUnchanged ) {
 
     EXPECT_TRUE( is_equal( result, expected ) );
 }
+
+TEST_F( BigNumberNegTest, TemporaryKeepsItsMantissa ) {
+    auto number = create_big_number( { 1, 2, 3, 4, 5, 6 }, 2, false );
+    BigNumber expected = create_big_number( { 1, 2, 3, 4, 5, 6 }, 2, true );
+    const chunk* data = number.mantissa.data();
+
+    auto result = neg( std::move( number ) );
+
+    EXPECT_EQ( result.mantissa.data(), data );
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberNegTest, ViewSharesTheMantissa ) {
+    auto number = create_big_number( { 1, 2, 3 }, -1, true );
+
+    BigNumberView result = neg( make_view( number ) );
+
+    EXPECT_EQ( result.mantissa.data(), number.mantissa.data() );
+    EXPECT_FALSE( result.is_negative );
+    EXPECT_TRUE( is_equal( result, make_view( neg( number ) ) ) );
+}
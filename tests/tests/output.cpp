@@ -194,3 +194,71 @@ TEST_F( BigNumberToStringTest,
     EXPECT_TRUE( result.find( "777" ) != std::string::npos );
     EXPECT_TRUE( result.find( "e" ) != std::string::npos );
 }
+
+TEST_F( BigNumberToStringTest, PadsInnerChunksWithLeadingZeros ) {
+    chunks chunks = { 5, 0, 10000000000, 1 };
+    auto number = create_big_number( chunks, 0, false );
+    std::string expected = "1" + std::string( 7, '0' ) + "10000000000" +
+                           std::string( BASE, '0' ) +
+                           std::string( BASE - 1, '0' ) + "5";
+
+    std::string result = big_number::to_string( number );
+
+    EXPECT_EQ( result, expected );
+}
+
+TEST_F( BigNumberToStringTest, FormatsExponentOfPositiveShift ) {
+    chunks chunks = { 123 };
+    auto number = create_big_number( chunks, 2, true );
+
+    std::string result = big_number::to_string( number );
+
+    EXPECT_EQ( result, "-123e36" );
+}
+
+TEST_F( BigNumberToStringTest, MatchesGmpForMaximumSize ) {
+    chunks chunks = create_random_chunks( MAX_CHUNKS, 42 );
+    auto number = create_big_number( chunks, 0, false );
+
+    std::string result = big_number::to_string( number );
+
+    EXPECT_EQ( result, to_mpz( chunks ).get_str() );
+}
+
+TEST_F( BigNumberToStringTest, ToCharsMatchesToString ) {
+    BigNumber numbers[] = {
+        make_nan( Error{}, true ),
+        make_inf( Error{}, false ),
+        make_zero( Error{}, true ),
+        create_big_number( { 7 }, 0, false ),
+        create_big_number( { 789, 0, 123 }, 4, true ),
+        create_big_number( { 999999999999999999, 1 }, -1000, false ),
+        create_big_number( create_random_chunks( MAX_CHUNKS, 7 ), 0, true ),
+    };
+
+    for ( const BigNumber& number : numbers ) {
+        std::string expected = big_number::to_string( number );
+        std::string buffer( expected.size() + 8, '#' );
+
+        auto [ptr, ec] = big_number::to_chars(
+            buffer.data(), buffer.data() + buffer.size(), number );
+
+        ASSERT_EQ( ec, std::errc{} );
+        EXPECT_EQ( formatted_length( number ), expected.size() );
+        EXPECT_EQ( std::string( buffer.data(), ptr ), expected );
+        EXPECT_EQ( buffer.substr( expected.size() ), std::string( 8, '#' ) );
+    }
+}
+
+TEST_F( BigNumberToStringTest, ToCharsReportsShortBuffer ) {
+    auto number = create_big_number( { 789, 123 }, -2, true );
+    size_t length = formatted_length( number );
+    std::string buffer( length - 1, '#' );
+
+    auto [ptr, ec] = big_number::to_chars(
+        buffer.data(), buffer.data() + buffer.size(), number );
+
+    EXPECT_EQ( ec, std::errc::value_too_large );
+    EXPECT_EQ( ptr, buffer.data() + buffer.size() );
+    EXPECT_EQ( buffer, std::string( length - 1, '#' ) );
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+class BigNumberSerializationTest : public ::testing::Test {
+protected:
+    static std::vector<std::byte> to_bytes( const BigNumber& number ) {
+        std::vector<std::byte> buffer( serialized_size( number ) );
+        EXPECT_EQ( serialize( number, buffer ), buffer.size() );
+        return buffer;
+    }
+};
+
+TEST_F( BigNumberSerializationTest, WritesHeaderAndChunks ) {
+    BigNumber number = create_big_number( { 5, 7 }, -3, true );
+    unsigned char expected[] = { 'B', 'N', 'U', 'M', 1, 0, 1, 0,
+                                 0xFD, 0xFF, 0xFF, 0xFF, 2, 0, 0, 0,
+                                 5, 0, 0, 0, 0, 0, 0, 0,
+                                 7, 0, 0, 0, 0, 0, 0, 0 };
+
+    std::vector<std::byte> buffer = to_bytes( number );
+
+    ASSERT_EQ( buffer.size(), sizeof( expected ) );
+    EXPECT_EQ( std::memcmp( buffer.data(), expected, sizeof( expected ) ), 0 );
+}
+
+TEST_F( BigNumberSerializationTest, RoundTripsWithoutCopying ) {
+    BigNumber number =
+        create_big_number( create_random_chunks( MAX_CHUNKS, 11 ), -20, true );
+    std::vector<std::byte> buffer = to_bytes( number );
+    BigNumberView view;
+
+    size_t consumed = deserialize( buffer, view );
+
+    EXPECT_EQ( consumed, buffer.size() );
+    EXPECT_EQ( static_cast<const void*>( view.mantissa.data() ),
+               static_cast<const void*>( buffer.data() + 16 ) );
+    EXPECT_TRUE( is_equal( view, make_view( number ) ) );
+    EXPECT_TRUE( is_equal( make_big_number( view ), number ) );
+}
+
+TEST_F( BigNumberSerializationTest, RoundTripsSpecialValues ) {
+    BigNumber numbers[] = { make_zero( get_default_error(), true ),
+                            make_inf( get_default_error(), true ),
+                            make_nan( make_error( ErrorCode::ERROR ) ) };
+
+    for ( const BigNumber& number : numbers ) {
+        std::vector<std::byte> buffer = to_bytes( number );
+        BigNumberView view;
+
+        ASSERT_EQ( deserialize( buffer, view ), buffer.size() );
+        EXPECT_EQ( view.type, number.type );
+        EXPECT_EQ( view.is_negative, number.is_negative );
+        EXPECT_EQ( get_error_code( view.error ),
+                   get_error_code( number.error ) );
+        EXPECT_TRUE( view.mantissa.empty() );
+    }
+}
+
+TEST_F( BigNumberSerializationTest, ReadsConsecutiveRecords ) {
+    BigNumber first = create_big_number( { 1, 2, 3 }, 4 );
+    BigNumber second = create_big_number( { 9 }, -1, true );
+    std::vector<std::byte> buffer = to_bytes( first );
+    std::vector<std::byte> tail = to_bytes( second );
+    buffer.insert( buffer.end(), tail.begin(), tail.end() );
+    BigNumberView view;
+
+    size_t consumed = deserialize( buffer, view );
+    EXPECT_TRUE( is_equal( view, make_view( first ) ) );
+    consumed += deserialize( std::span( buffer ).subspan( consumed ), view );
+
+    EXPECT_EQ( consumed, buffer.size() );
+    EXPECT_TRUE( is_equal( view, make_view( second ) ) );
+}
+
+TEST_F( BigNumberSerializationTest, ReportsShortBuffer ) {
+    BigNumber number = create_big_number( { 1, 2 }, 0 );
+    std::vector<std::byte> buffer( serialized_size( number ) - 1 );
+
+    EXPECT_EQ( serialize( number, buffer ), 0 );
+}
+
+TEST_F( BigNumberSerializationTest, RejectsMalformedBuffers ) {
+    BigNumber number = create_big_number( { 1, 2 }, 0 );
+    std::vector<std::byte> valid = to_bytes( number );
+    BigNumberView view;
+
+    auto rejects = [&]( std::vector<std::byte> buffer ) {
+        return deserialize( buffer, view ) == 0;
+    };
+    auto with_byte = [&]( size_t index, unsigned char value ) {
+        std::vector<std::byte> buffer = valid;
+        buffer[index] = std::byte{ value };
+        return buffer;
+    };
+
+    EXPECT_TRUE( rejects( {} ) );
+    EXPECT_TRUE( rejects( { valid.begin(), valid.end() - 1 } ) );
+    EXPECT_TRUE( rejects( with_byte( 0, 'X' ) ) );
+    EXPECT_TRUE( rejects( with_byte( 4, 2 ) ) );
+    EXPECT_TRUE( rejects( with_byte( 5, 7 ) ) );
+    EXPECT_TRUE( rejects( with_byte( 6, 2 ) ) );
+    EXPECT_TRUE( rejects( with_byte( 14, 1 ) ) );
+    EXPECT_TRUE( rejects( with_byte( 16, 0 ) ) );
+}
+
+TEST_F( BigNumberSerializationTest, RejectsChunksOutOfRange ) {
+    BigNumber number = create_big_number( { 1, 2, 3 }, 0 );
+    std::vector<std::byte> buffer = to_bytes( number );
+    BigNumberView view;
+
+    for ( chunk value : { MAX_CHUNK, ~chunk( 0 ) } ) {
+        std::memcpy( buffer.data() + 24, &value, sizeof( value ) );
+
+        EXPECT_EQ( deserialize( buffer, view ), 0 );
+    }
+}
+
+TEST_F( BigNumberSerializationTest, RoundTripsSubtractionResult ) {
+    BigNumber number = sub( create_big_number( { 5, 1 }, 0 ),
+                            create_big_number( { 1 }, 1 ) );
+    std::vector<std::byte> buffer = to_bytes( number );
+    BigNumberView view;
+
+    ASSERT_EQ( deserialize( buffer, view ), buffer.size() );
+    EXPECT_TRUE( is_equal( view, make_view( number ) ) );
+}
+
+TEST_F( BigNumberSerializationTest, RefusesWhatItCannotRead ) {
+    BigNumber numbers[] = { create_big_number( { 5, 0 }, 0 ),
+                            create_big_number( { MAX_CHUNK }, 0 ) };
+
+    for ( const BigNumber& number : numbers ) {
+        std::vector<std::byte> buffer( serialized_size( number ) );
+
+        EXPECT_EQ( serialize( number, buffer ), 0 );
+    }
+}
+
+TEST_F( BigNumberSerializationTest, RejectsMisalignedChunks ) {
+    BigNumber number = create_big_number( { 1, 2 }, 0 );
+    std::vector<std::byte> bytes = to_bytes( number );
+    std::vector<std::byte> buffer( bytes.size() + 1 );
+    std::copy( bytes.begin(), bytes.end(), buffer.begin() + 1 );
+    BigNumberView view;
+
+    EXPECT_EQ( deserialize( std::span( buffer ).subspan( 1 ), view ), 0 );
+}
+
+TEST_F( BigNumberSerializationTest, ViewsFeedArithmetic ) {
+    BigNumber lhs =
+        create_big_number( create_random_chunks( 300, 1 ), -100, true );
+    BigNumber rhs = create_big_number( create_random_chunks( 200, 2 ), 20 );
+    std::vector<std::byte> lhs_buffer = to_bytes( lhs );
+    std::vector<std::byte> rhs_buffer = to_bytes( rhs );
+    BigNumberView lhs_view;
+    BigNumberView rhs_view;
+    ASSERT_NE( deserialize( lhs_buffer, lhs_view ), 0 );
+    ASSERT_NE( deserialize( rhs_buffer, rhs_view ), 0 );
+
+    EXPECT_TRUE( is_equal( add( lhs_view, rhs_view ), add( lhs, rhs ) ) );
+    EXPECT_TRUE( is_equal( sub( lhs_view, rhs_view ), sub( lhs, rhs ) ) );
+    EXPECT_TRUE( is_equal( mul( lhs_view, rhs_view ), mul( lhs, rhs ) ) );
+    EXPECT_EQ( is_lower_than( lhs_view, rhs_view ), is_lower_than( lhs, rhs ) );
+    EXPECT_EQ( is_lower_than( rhs_view, lhs_view ), is_lower_than( rhs, lhs ) );
+}
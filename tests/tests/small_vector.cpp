@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "constants.hpp"
+#include "small_vector.hpp"
+
+using namespace big_number;
+
+class SmallVectorTest : public ::testing::Test {
+protected:
+    using Vector = SmallVector<chunk, 4>;
+
+    static std::vector<chunk> to_vector( const Vector& values ) {
+        return { values.begin(), values.end() };
+    }
+};
+
+TEST_F( SmallVectorTest, ShortValuesStayInline ) {
+    Vector values = { 1, 2, 3, 4 };
+    const chunk* inline_data = values.data();
+
+    Vector copy = values;
+    Vector moved = std::move( copy );
+
+    EXPECT_EQ( values.capacity(), 4 );
+    EXPECT_EQ( moved.capacity(), 4 );
+    EXPECT_TRUE( copy.empty() );
+    EXPECT_EQ( to_vector( moved ), ( std::vector<chunk>{ 1, 2, 3, 4 } ) );
+    EXPECT_EQ( values.data(), inline_data );
+}
+
+TEST_F( SmallVectorTest, GrowsOntoTheHeap ) {
+    Vector values;
+    for ( chunk value = 0; value < 100; ++value ) {
+        values.push_back( value );
+    }
+
+    EXPECT_EQ( values.size(), 100 );
+    EXPECT_GE( values.capacity(), 100 );
+    for ( chunk value = 0; value < 100; ++value ) {
+        EXPECT_EQ( values[value], value );
+    }
+}
+
+TEST_F( SmallVectorTest, MoveStealsTheHeapBuffer ) {
+    Vector values( 10, 7 );
+    const chunk* heap_data = values.data();
+
+    Vector moved = std::move( values );
+    values = { 5 };
+
+    EXPECT_EQ( moved.data(), heap_data );
+    EXPECT_EQ( to_vector( moved ), std::vector<chunk>( 10, 7 ) );
+    EXPECT_EQ( to_vector( values ), std::vector<chunk>{ 5 } );
+}
+
+TEST_F( SmallVectorTest, InsertAndEraseMatchVector ) {
+    Vector values = { 1, 2, 3 };
+    std::vector<chunk> expected = { 1, 2, 3 };
+
+    values.insert( values.begin(), 2, 0 );
+    expected.insert( expected.begin(), 2, 0 );
+    values.insert( values.begin() + 3, { 8, 9 } );
+    expected.insert( expected.begin() + 3, { 8, 9 } );
+    values.insert( values.end(), values.begin(), values.begin() + 4 );
+    std::vector<chunk> head( expected.begin(), expected.begin() + 4 );
+    expected.insert( expected.end(), head.begin(), head.end() );
+    values.erase( values.begin() + 1, values.begin() + 5 );
+    expected.erase( expected.begin() + 1, expected.begin() + 5 );
+    values.resize( 12, 6 );
+    expected.resize( 12, 6 );
+
+    EXPECT_EQ( to_vector( values ), expected );
+}
+
+TEST_F( SmallVectorTest, AssignReplacesTheContents ) {
+    std::vector<chunk> long_values( 9, 3 );
+    Vector values = { 1, 2 };
+
+    values.assign( long_values.begin(), long_values.end() );
+    EXPECT_EQ( to_vector( values ), long_values );
+
+    values.assign( 2, 4 );
+    EXPECT_EQ( to_vector( values ), ( std::vector<chunk>{ 4, 4 } ) );
+    EXPECT_TRUE( values == Vector( { 4, 4 } ) );
+}
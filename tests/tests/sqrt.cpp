@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+class BigNumberSqrtTest : public ::testing::Test {
+protected:
+    Error error = get_default_error();
+
+    // Roots are truncated to MAX_CHUNKS chunks and never below -MAX_SHIFT,
+    // so the dropped part is below one unit of the last chunk.
+    static int32_t unit_of( const BigNumber& root ) {
+        return std::max( root.shift +
+                             static_cast<int32_t>( root.mantissa.size() ) -
+                             static_cast<int32_t>( MAX_CHUNKS ),
+                         -MAX_SHIFT );
+    }
+
+    void expect_sqrt_matches_gmp( size_t size, int32_t shift ) {
+        chunks value_chunks = create_random_chunks( size, size + 11 );
+        BigNumber value = create_big_number( value_chunks, shift );
+
+        BigNumber root = sqrt( value );
+
+        ASSERT_EQ( root.type, BigNumberType::DEFAULT );
+        ASSERT_LE( root.mantissa.size(), MAX_CHUNKS );
+        EXPECT_FALSE( root.is_negative );
+
+        int32_t unit = unit_of( root );
+        int32_t exponent = std::min( unit, shift / 2 - 1 );
+        mpz_class lower = to_scaled_mpz( root, exponent );
+        mpz_class upper = lower + power_of_base( unit - exponent );
+        mpz_class radicand = to_scaled_mpz( value, 2 * exponent );
+
+        EXPECT_LE( lower * lower, radicand ) << size << " " << shift;
+        EXPECT_GT( upper * upper, radicand ) << size << " " << shift;
+    }
+
+    void expect_rsqrt_matches_gmp( size_t size, int32_t shift ) {
+        chunks value_chunks = create_random_chunks( size, size + 13 );
+        BigNumber value = create_big_number( value_chunks, shift );
+
+        BigNumber root = rsqrt( value );
+
+        ASSERT_EQ( root.type, BigNumberType::DEFAULT );
+        ASSERT_LE( root.mantissa.size(), MAX_CHUNKS );
+        EXPECT_FALSE( root.is_negative );
+
+        // root^2 * value <= 1 < ( root + unit )^2 * value, scaled by
+        // MAX_CHUNK^-exponent.
+        int32_t unit = unit_of( root );
+        int32_t exponent = std::min( 2 * unit + shift, 0 );
+        mpz_class lower = to_scaled_mpz( root, unit );
+        mpz_class upper = lower + 1;
+        mpz_class scale = to_mpz( value_chunks ) *
+                          power_of_base( 2 * unit + shift - exponent );
+        mpz_class one = power_of_base( -exponent );
+
+        EXPECT_LE( lower * lower * scale, one ) << size << " " << shift;
+        EXPECT_GT( upper * upper * scale, one ) << size << " " << shift;
+    }
+};
+
+TEST_F( BigNumberSqrtTest, SqrtOfFour ) {
+    BigNumber number = create_big_number( { 4 }, 0 );
+    BigNumber expected = create_big_number( { 2 }, 0 );
+
+    BigNumber result = sqrt( number );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfQuarter ) {
+    BigNumber number = create_big_number( { 250000000000000000 }, -1 );
+    BigNumber expected = create_big_number( { 500000000000000000 }, -1 );
+
+    BigNumber result = sqrt( number );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfOddPowerOfBase ) {
+    BigNumber number = create_big_number( { 0, 1 }, 0 );
+    BigNumber expected = create_big_number( { 1000000000 }, 0 );
+
+    BigNumber result = sqrt( number );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberSqrtTest, RsqrtOfFour ) {
+    BigNumber number = create_big_number( { 4 }, 0 );
+    BigNumber expected = create_big_number( { 500000000000000000 }, -1 );
+
+    BigNumber result = rsqrt( number );
+
+    EXPECT_TRUE( is_equal( result, expected ) );
+}
+
+TEST_F( BigNumberSqrtTest, RsqrtOfEvenPowersOfBase ) {
+    for ( int32_t shift : { -4, 0, 2 } ) {
+        BigNumber number = create_big_number( { 1 }, shift );
+        BigNumber expected = create_big_number( { 1 }, -shift / 2 );
+
+        BigNumber result = rsqrt( number );
+
+        EXPECT_TRUE( is_equal( result, expected ) ) << shift;
+    }
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfZero ) {
+    BigNumber zero = make_zero( error );
+
+    BigNumber result = sqrt( zero );
+
+    EXPECT_TRUE( result.type == BigNumberType::ZERO );
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfNegativeIsNan ) {
+    BigNumber number = create_big_number( { 4 }, 0, true );
+
+    BigNumber result = sqrt( number );
+
+    EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfInfinity ) {
+    BigNumber inf = make_inf( error, false );
+
+    BigNumber result = sqrt( inf );
+
+    EXPECT_TRUE( result.type == BigNumberType::INF );
+    EXPECT_FALSE( result.is_negative );
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfNegativeInfinityIsNan ) {
+    BigNumber inf = make_inf( error, true );
+
+    BigNumber result = sqrt( inf );
+
+    EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfNan ) {
+    BigNumber nan = make_nan( error );
+
+    BigNumber result = sqrt( nan );
+
+    EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberSqrtTest, RsqrtOfZeroIsInfinity ) {
+    BigNumber zero = make_zero( error );
+
+    BigNumber result = rsqrt( zero );
+
+    EXPECT_TRUE( result.type == BigNumberType::INF );
+    EXPECT_FALSE( result.is_negative );
+}
+
+TEST_F( BigNumberSqrtTest, RsqrtOfInfinityIsZero ) {
+    BigNumber inf = make_inf( error, false );
+
+    BigNumber result = rsqrt( inf );
+
+    EXPECT_TRUE( result.type == BigNumberType::ZERO );
+}
+
+TEST_F( BigNumberSqrtTest, RsqrtOfNegativeIsNan ) {
+    BigNumber number = create_big_number( { 4 }, 0, true );
+
+    BigNumber result = rsqrt( number );
+
+    EXPECT_TRUE( result.type == BigNumberType::NOT_A_NUMBER );
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfSquareIsExact ) {
+    const size_t sizes[] = { 1, 3, 40, 1000, MAX_CHUNKS / 2 };
+
+    for ( size_t size : sizes ) {
+        BigNumber value =
+            create_big_number( create_random_chunks( size, size ), -7 );
+
+        BigNumber result = sqrt( sqr( value ) );
+
+        EXPECT_TRUE( is_equal( result, value ) ) << size;
+    }
+}
+
+TEST_F( BigNumberSqrtTest, SqrtOfSquareWithFullTopChunks ) {
+    for ( size_t size : { 1, 2, 5 } ) {
+        BigNumber value =
+            create_big_number( chunks( size, ALMOST_MAX_CHUNK ), 0 );
+
+        BigNumber result = sqrt( sqr( value ) );
+
+        EXPECT_TRUE( is_equal( result, value ) ) << size;
+    }
+}
+
+TEST_F( BigNumberSqrtTest, SqrtMatchesGmp ) {
+    const std::pair<size_t, int32_t> cases[] = { { 1, 0 },
+                                                 { 2, -1 },
+                                                 { 3, 5 },
+                                                 { 17, 0 },
+                                                 { 40, -3 },
+                                                 { 300, 7 },
+                                                 { 1500, -1500 },
+                                                 { 10, MAX_SHIFT - 10 },
+                                                 { MAX_CHUNKS, 0 },
+                                                 { MAX_CHUNKS, -MAX_SHIFT } };
+
+    for ( const auto& [size, shift] : cases ) {
+        expect_sqrt_matches_gmp( size, shift );
+    }
+}
+
+TEST_F( BigNumberSqrtTest, RsqrtMatchesGmp ) {
+    const std::pair<size_t, int32_t> cases[] = { { 1, 0 },
+                                                 { 2, -2 },
+                                                 { 5, 3 },
+                                                 { 40, -41 },
+                                                 { 100, 1000 },
+                                                 { 500, -500 },
+                                                 { 2000, -3000 },
+                                                 { MAX_CHUNKS, 0 },
+                                                 { MAX_CHUNKS, -MAX_SHIFT } };
+
+    for ( const auto& [size, shift] : cases ) {
+        expect_rsqrt_matches_gmp( size, shift );
+    }
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "big_number.hpp"
+#include "constants.hpp"
+#include "tools.hpp"
+
+using namespace big_number;
+
+class BigNumberStoreTest : public ::testing::Test {
+protected:
+    std::string path =
+        ( std::filesystem::temp_directory_path() /
+          ( "big_number_store_" + std::to_string( ::getpid() ) + ".bin" ) )
+            .string();
+
+    void TearDown() override { std::filesystem::remove( path ); }
+
+    std::vector<BigNumber> create_numbers() {
+        return { create_big_number( { 123 }, 0 ),
+                 create_big_number( create_random_chunks( 700, 5 ), -9, true ),
+                 make_zero( get_default_error() ),
+                 make_inf( get_default_error(), true ),
+                 create_big_number( create_random_chunks( MAX_CHUNKS, 6 ), 3 ),
+                 create_big_number( { 1, 2 }, -MAX_SHIFT ) };
+    }
+};
+
+TEST_F( BigNumberStoreTest, OpensWrittenValues ) {
+    std::vector<BigNumber> numbers = create_numbers();
+    ASSERT_TRUE( is_ok( write_store( path, numbers ) ) );
+
+    BigNumberStore store = open_store( path );
+
+    ASSERT_TRUE( is_ok( store.error ) );
+    ASSERT_EQ( get_store_size( store ), numbers.size() );
+    for ( size_t i = numbers.size(); i-- > 0; ) {
+        BigNumberView view = get_store_value( store, i );
+        EXPECT_EQ( view.type, numbers[i].type ) << i;
+        EXPECT_EQ( view.is_negative, numbers[i].is_negative ) << i;
+        EXPECT_TRUE( is_equal( make_big_number( view ), numbers[i] ) ) << i;
+    }
+}
+
+TEST_F( BigNumberStoreTest, ValuesFeedArithmetic ) {
+    std::vector<BigNumber> numbers = create_numbers();
+    ASSERT_TRUE( is_ok( write_store( path, numbers ) ) );
+    BigNumberStore store = open_store( path );
+
+    BigNumberView lhs = get_store_value( store, 1 );
+    BigNumberView rhs = get_store_value( store, 4 );
+
+    EXPECT_TRUE( is_equal( add( lhs, rhs ), add( numbers[1], numbers[4] ) ) );
+    EXPECT_TRUE( is_equal( mul( lhs, rhs ), mul( numbers[1], numbers[4] ) ) );
+    EXPECT_TRUE( is_lower_than( lhs, rhs ) );
+}
+
+TEST_F( BigNumberStoreTest, EmptyStore ) {
+    ASSERT_TRUE( is_ok( write_store( path, {} ) ) );
+
+    BigNumberStore store = open_store( path );
+
+    EXPECT_TRUE( is_ok( store.error ) );
+    EXPECT_EQ( get_store_size( store ), 0 );
+}
+
+TEST_F( BigNumberStoreTest, OutOfRangeIndexIsNaN ) {
+    std::vector<BigNumber> numbers = create_numbers();
+    ASSERT_TRUE( is_ok( write_store( path, numbers ) ) );
+    BigNumberStore store = open_store( path );
+
+    BigNumberView view = get_store_value( store, numbers.size() );
+
+    EXPECT_EQ( view.type, BigNumberType::NOT_A_NUMBER );
+    EXPECT_FALSE( is_ok( view.error ) );
+}
+
+TEST_F( BigNumberStoreTest, RejectsMissingAndCorruptFiles ) {
+    EXPECT_FALSE( is_ok( open_store( path ).error ) );
+
+    std::vector<BigNumber> numbers = create_numbers();
+    ASSERT_TRUE( is_ok( write_store( path, numbers ) ) );
+    std::filesystem::resize_file( path, 40 );
+
+    BigNumberStore store = open_store( path );
+
+    EXPECT_FALSE( is_ok( store.error ) );
+    EXPECT_EQ( get_store_size( store ), 0 );
+}
+
+TEST_F( BigNumberStoreTest, RejectsUnorderedIndex ) {
+    std::vector<BigNumber> numbers = create_numbers();
+    ASSERT_TRUE( is_ok( write_store( path, numbers ) ) );
+    {
+        std::fstream file( path, std::ios::binary | std::ios::in |
+                                     std::ios::out );
+        uint64_t offset = 8;
+        file.seekp( 16 + sizeof( offset ) );
+        file.write( reinterpret_cast<const char*>( &offset ),
+                    sizeof( offset ) );
+    }
+
+    EXPECT_FALSE( is_ok( open_store( path ).error ) );
+}
+
+TEST_F( BigNumberStoreTest, RejectsChunksOutOfRange ) {
+    std::vector<BigNumber> numbers = create_numbers();
+    ASSERT_TRUE( is_ok( write_store( path, numbers ) ) );
+    {
+        std::fstream file( path, std::ios::binary | std::ios::in |
+                                     std::ios::out );
+        uint64_t offset = 0;
+        file.seekg( 16 + sizeof( offset ) );
+        file.read( reinterpret_cast<char*>( &offset ), sizeof( offset ) );
+
+        chunk value = MAX_CHUNK;
+        file.seekp( offset + 16 + sizeof( value ) );
+        file.write( reinterpret_cast<const char*>( &value ),
+                    sizeof( value ) );
+    }
+
+    EXPECT_FALSE( is_ok( open_store( path ).error ) );
+}
+
+TEST_F( BigNumberStoreTest, ReopensSubtractionResult ) {
+    std::vector<BigNumber> numbers = {
+        sub( create_big_number( { 5, 1 }, 0 ), create_big_number( { 1 }, 1 ) ),
+        create_big_number( { 123 }, 0 ) };
+    ASSERT_TRUE( is_ok( write_store( path, numbers ) ) );
+
+    BigNumberStore store = open_store( path );
+
+    ASSERT_TRUE( is_ok( store.error ) );
+    ASSERT_EQ( get_store_size( store ), numbers.size() );
+    EXPECT_TRUE(
+        is_equal( get_store_value( store, 0 ), make_view( numbers[0] ) ) );
+}
+
+TEST_F( BigNumberStoreTest, RefusesToWriteUnreadableValues ) {
+    std::vector<BigNumber> numbers = { create_big_number( { 123 }, 0 ),
+                                       create_big_number( { 5, 0 }, 0 ) };
+
+    EXPECT_FALSE( is_ok( write_store( path, numbers ) ) );
+    EXPECT_FALSE( std::filesystem::exists( path ) );
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "big_number.hpp"
 #include "constants.hpp"
 #include "error.hpp"
@@ -7,7 +9,23 @@
 
 using namespace big_number;
 
-class BigNumberSubTest : public ::testing::Test {};
+class BigNumberSubTest : public ::testing::Test {
+protected:
+    // Low-only parts, gaps, partial and full overlaps and tails on either
+    // side, with random chunks so the carries are irregular.
+    static std::vector<BigNumber> create_layout_operands() {
+        std::vector<BigNumber> numbers;
+        uint64_t seed = 100;
+        for ( int32_t shift : { -9, -4, 0, 2, 11 } ) {
+            for ( size_t size : { 1, 3, 8 } ) {
+                chunks values = create_random_chunks( size, ++seed );
+                numbers.push_back( create_big_number( values, shift, false ) );
+                numbers.push_back( create_big_number( values, shift, true ) );
+            }
+        }
+        return numbers;
+    }
+};
 
 TEST_F( BigNumberSubTest, SubtractTwoPositiveNumbersPositiveResult ) {
     auto a = create_big_number( { 500 }, 0, false );
@@ -201,3 +219,109 @@ TEST_F( BigNumberSubTest, SubtractPreservesErrorFromLeftOperand ) {
 
     EXPECT_FALSE( is_equal( result, number ) );
 }
+
+TEST_F( BigNumberSubTest, SubAssignMatchesSub ) {
+    std::vector<BigNumber> numbers = {
+        make_zero( Error{} ),
+        make_inf( Error{}, false ),
+        create_big_number( { 1 }, 0, false ),
+        create_big_number( { 999999999999999999, 5 }, -1, false ),
+        create_big_number( { 3, 0, 7 }, 2, true ),
+        create_big_number( { 1, 2, 3, 4, 5 }, -3, false ),
+        create_big_number( { 6, 0, 0, 0, 5 }, -3, true ) };
+
+    for ( const BigNumber& lhs : numbers ) {
+        for ( const BigNumber& rhs : numbers ) {
+            BigNumber expected = sub( lhs, rhs );
+            BigNumber result = lhs;
+
+            sub_assign( result, rhs );
+
+            EXPECT_TRUE( is_equal( result, expected ) ||
+                         ( result.type == BigNumberType::NOT_A_NUMBER &&
+                           expected.type == BigNumberType::NOT_A_NUMBER ) )
+                << to_string( lhs ) << " - " << to_string( rhs );
+        }
+    }
+}
+
+TEST_F( BigNumberSubTest, SubAssignLargerMagnitudeFlipsSign ) {
+    BigNumber accumulator = create_big_number( { 5 }, 1, false );
+    BigNumber subtrahend = create_big_number( { 1, 0, 7 }, -1, false );
+    BigNumber expected = create_big_number( { 1, 0, 2 }, -1, true );
+
+    sub_assign( accumulator, subtrahend );
+
+    EXPECT_TRUE( is_equal( accumulator, expected ) );
+}
+
+TEST_F( BigNumberSubTest, SubAssignFromItselfIsZero ) {
+    BigNumber accumulator = create_big_number( { 1, 2, 3 }, -1, true );
+
+    sub_assign( accumulator, accumulator );
+
+    EXPECT_EQ( accumulator.type, BigNumberType::ZERO );
+}
+
+TEST_F( BigNumberSubTest, SubMatchesGmpAcrossLayouts ) {
+    std::vector<BigNumber> numbers = create_layout_operands();
+    constexpr int32_t MIN_EXPONENT = -20;
+
+    for ( const BigNumber& lhs : numbers ) {
+        for ( const BigNumber& rhs : numbers ) {
+            BigNumber result = sub( lhs, rhs );
+
+            EXPECT_EQ( to_scaled_mpz( result, MIN_EXPONENT ),
+                       to_scaled_mpz( lhs, MIN_EXPONENT ) -
+                           to_scaled_mpz( rhs, MIN_EXPONENT ) )
+                << to_string( lhs ) << " - " << to_string( rhs );
+        }
+    }
+}
+
+TEST_F( BigNumberSubTest, SubtractCancelledTopChunks ) {
+    BigNumber lhs = create_big_number( { 5, 1 }, 0, false );
+    BigNumber rhs = create_big_number( { 1 }, 1, false );
+
+    BigNumber difference = sub( lhs, rhs );
+
+    EXPECT_EQ( difference.mantissa, chunks( { 5 } ) );
+    EXPECT_TRUE( is_equal( difference, create_big_number( { 5 }, 0 ) ) );
+    EXPECT_LT( compare( difference, create_big_number( { 7 }, 0 ) ), 0 );
+    EXPECT_TRUE( is_equal( sub( difference, create_big_number( { 7 }, 0 ) ),
+                           create_big_number( { 2 }, 0, true ) ) );
+}
+
+TEST_F( BigNumberSubTest, SubtractFromDifferenceMatchesGmp ) {
+    std::vector<BigNumber> numbers = create_layout_operands();
+    constexpr int32_t MIN_EXPONENT = -20;
+
+    for ( const BigNumber& lhs : numbers ) {
+        for ( const BigNumber& rhs : numbers ) {
+            BigNumber result = sub( sub( lhs, rhs ), rhs );
+
+            EXPECT_EQ( to_scaled_mpz( result, MIN_EXPONENT ),
+                       to_scaled_mpz( lhs, MIN_EXPONENT ) -
+                           2 * to_scaled_mpz( rhs, MIN_EXPONENT ) )
+                << to_string( lhs ) << " - 2 * " << to_string( rhs );
+        }
+    }
+}
+
+TEST_F( BigNumberSubTest, SubAssignCancelledTopChunks ) {
+    BigNumber accumulator = create_big_number( { 5, 1 }, 0, false );
+
+    sub_assign( accumulator, create_big_number( { 1 }, 1, false ) );
+
+    EXPECT_EQ( accumulator.mantissa, chunks( { 5 } ) );
+    sub_assign( accumulator, create_big_number( { 7 }, 0, false ) );
+    EXPECT_TRUE(
+        is_equal( accumulator, create_big_number( { 2 }, 0, true ) ) );
+
+    BigNumber reversed = create_big_number( { 9 }, 0, false );
+
+    sub_assign( reversed, create_big_number( { 4, 1 }, 0, false ) );
+
+    EXPECT_EQ( reversed.mantissa, chunks( { 999999999999999995 } ) );
+    EXPECT_TRUE( reversed.is_negative );
+}
@@ -1,5 +1,7 @@
 #include "tools.hpp"
 
+#include <random>
+
 #include "big_number.hpp"
 #include "error.hpp"
 
@@ -9,3 +11,38 @@ BigNumber create_big_number( const chunks& mantissa,
                            BigNumberType type ) {
     return BigNumber( mantissa, shift, type, get_default_error(), is_negative );
 }
+
+chunks create_random_chunks( size_t size, uint64_t seed ) {
+    std::mt19937_64 generator( seed );
+    std::uniform_int_distribution<chunk> distribution( 1, MAX_CHUNK - 1 );
+
+    chunks mantissa( size );
+    for ( chunk& value : mantissa ) {
+        value = distribution( generator );
+    }
+    return mantissa;
+}
+
+mpz_class to_mpz( const chunks& mantissa ) {
+    mpz_class result = 0;
+    mpz_class base( std::to_string( MAX_CHUNK ) );
+
+    for ( size_t i = mantissa.size(); i-- > 0; ) {
+        result = result * base + mpz_class( std::to_string( mantissa[i] ) );
+    }
+    return result;
+}
+
+mpz_class power_of_base( int32_t exponent ) {
+    mpz_class result;
+    mpz_ui_pow_ui( result.get_mpz_t(), 10, BASE * exponent );
+    return result;
+}
+
+mpz_class to_scaled_mpz( const BigNumber& number, int32_t exponent ) {
+    if ( number.type == BigNumberType::ZERO ) return 0;
+
+    mpz_class result =
+        to_mpz( number.mantissa ) * power_of_base( number.shift - exponent );
+    return number.is_negative ? mpz_class( -result ) : result;
+}
@@ -1,3 +1,5 @@
+#include <gmpxx.h>
+
 #include "big_number.hpp"
 
 using namespace big_number;
@@ -6,3 +8,14 @@ BigNumber create_big_number( const chunks& chunks,
                              int32_t shift,
                              bool is_negative = false,
                              BigNumberType type = BigNumberType::DEFAULT );
+
+chunks create_random_chunks( size_t size, uint64_t seed );
+
+mpz_class to_mpz( const chunks& mantissa );
+
+// MAX_CHUNK^exponent, for exponents >= 0.
+mpz_class power_of_base( int32_t exponent );
+
+// number * MAX_CHUNK^-exponent with its sign, which is an integer for
+// exponents not above the shift of number.
+mpz_class to_scaled_mpz( const BigNumber& number, int32_t exponent );